@@ -0,0 +1,108 @@
+###############################################
+###          generate_timings               ###
+###############################################
+###
+### Generates compile-time timing specializations
+### of the DDR4 checker for the memspec files
+### listed in DRAMSYS_CONSTEXPR_MEMSPECS
+###
+
+function( dramsys_write_timings output_file )
+	set(structs "")
+	set(names "")
+
+	foreach(memspec_file ${ARGN})
+		if(NOT IS_ABSOLUTE "${memspec_file}" AND NOT EXISTS "${memspec_file}")
+			set(memspec_file "${DRAMSYS_RESOURCE_DIR}/memspec/${memspec_file}")
+		endif()
+		if(NOT EXISTS "${memspec_file}")
+			message(FATAL_ERROR "Memspec ${memspec_file} not found")
+		endif()
+
+		set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${memspec_file}")
+		file(READ "${memspec_file}" memspec)
+
+		string(JSON memory_type GET "${memspec}" memspec memoryType)
+		if(NOT memory_type STREQUAL "DDR4")
+			message(WARNING "${memspec_file}: only DDR4 memspecs are specialized, ${memory_type} uses the runtime timings")
+			continue()
+		endif()
+
+		string(JSON memory_id GET "${memspec}" memspec memoryId)
+		string(MAKE_C_IDENTIFIER "TimingsDDR4_${memory_id}" name)
+		if(name IN_LIST names)
+			continue()
+		endif()
+
+		string(JSON clk_mhz GET "${memspec}" memspec memtimingspec clkMhz)
+		string(JSON refresh_mode GET "${memspec}" memspec memtimingspec REFM)
+		if(refresh_mode EQUAL 4)
+			set(rfc_entry RFC4)
+		elseif(refresh_mode EQUAL 2)
+			set(rfc_entry RFC2)
+		else()
+			set(rfc_entry RFC)
+		endif()
+
+		set(struct "struct ${name}\n{\n")
+		string(APPEND struct "    explicit constexpr ${name}(const MemSpecDDR4& /*memSpec*/) {}\n\n")
+		string(APPEND struct "    static constexpr std::string_view memoryId = \"${memory_id}\";\n")
+		string(APPEND struct "    static constexpr TimingConstant tCK = TimingConstant::fromMHz(${clk_mhz});\n")
+
+		foreach(timing ACTPDEN AL CCD_L CCD_S CKE CKESR FAW PRPDEN RAS RC RCD REFPDEN RL RP RPRE
+		               RRD_L RRD_S RTP RTRS WL WPRE WR WTR_L WTR_S XP XS XSDLL)
+			string(JSON cycles GET "${memspec}" memspec memtimingspec ${timing})
+			if(NOT cycles MATCHES "^[0-9]+$")
+				message(FATAL_ERROR "${memspec_file}: ${timing} is not an integer number of cycles")
+			endif()
+			string(APPEND struct "    static constexpr TimingConstant t${timing} = tCK * ${cycles};\n")
+		endforeach()
+
+		string(JSON cycles GET "${memspec}" memspec memtimingspec ${rfc_entry})
+		string(APPEND struct "    static constexpr TimingConstant tRFC = tCK * ${cycles};\n")
+		string(APPEND struct "    static constexpr TimingConstant tPD = tCKE;\n")
+
+		# Derived checker constraints, same expressions as TimingsDDR4 in CheckerDDR4.cpp
+		string(JSON burst_length GET "${memspec}" memspec memarchitecturespec burstLength)
+		string(JSON data_rate GET "${memspec}" memspec memarchitecturespec dataRate)
+		math(EXPR burst_cycles "${burst_length} / ${data_rate}")
+		string(APPEND struct "\n    static constexpr TimingConstant tBURST = tCK * ${burst_cycles};\n")
+		string(APPEND struct "    static constexpr TimingConstant tRDWR = tRL + tBURST + tCK - tWL + tWPRE;\n")
+		string(APPEND struct "    static constexpr TimingConstant tRDWR_R = tRL + tBURST + tRTRS - tWL + tWPRE;\n")
+		string(APPEND struct "    static constexpr TimingConstant tWRRD_S = tWL + tBURST + tWTR_S - tAL;\n")
+		string(APPEND struct "    static constexpr TimingConstant tWRRD_L = tWL + tBURST + tWTR_L - tAL;\n")
+		string(APPEND struct "    static constexpr TimingConstant tWRRD_R = tWL + tBURST + tRTRS - tRL + tRPRE;\n")
+		string(APPEND struct "    static constexpr TimingConstant tWRPRE = tWL + tBURST + tWR;\n")
+		string(APPEND struct "    static constexpr TimingConstant tRDPDEN = tRL + tBURST + tCK;\n")
+		string(APPEND struct "    static constexpr TimingConstant tWRPDEN = tWL + tBURST + tWR;\n")
+		string(APPEND struct "    static constexpr TimingConstant tWRAPDEN = tWL + tBURST + tCK + tWR;\n")
+		string(APPEND struct "    static constexpr TimingConstant tRDASREFEN = max(tRDPDEN, tAL + tRTP + tRP);\n")
+		string(APPEND struct "    static constexpr TimingConstant tWRASREFEN = max(tWRAPDEN, tWRPRE + tRP);\n")
+		string(APPEND struct "};\n\n")
+
+		string(APPEND structs "${struct}")
+		list(APPEND names ${name})
+	endforeach()
+
+	list(JOIN names ", " name_list)
+
+	set(content "// Generated by cmake/generate_timings.cmake, do not edit\n\n")
+	string(APPEND content "#ifndef GENERATEDTIMINGSDDR4_H\n#define GENERATEDTIMINGSDDR4_H\n\n")
+	string(APPEND content "#include \"DRAMSys/configuration/memspec/MemSpecDDR4.h\"\n")
+	string(APPEND content "#include \"DRAMSys/controller/checker/TimingConstant.h\"\n\n")
+	string(APPEND content "#include <string_view>\n#include <tuple>\n\n")
+	string(APPEND content "namespace DRAMSys\n{\n\n${structs}")
+	string(APPEND content "using GeneratedTimingsDDR4 = std::tuple<${name_list}>;\n\n")
+	string(APPEND content "} // namespace DRAMSys\n\n#endif // GENERATEDTIMINGSDDR4_H\n")
+
+	file(CONFIGURE OUTPUT "${output_file}" CONTENT "${content}" @ONLY)
+endfunction()
+
+function( dramsys_generate_timings target_name )
+	set(generated_dir "${CMAKE_CURRENT_BINARY_DIR}/generated")
+	dramsys_write_timings("${generated_dir}/DRAMSys/controller/checker/GeneratedTimingsDDR4.h"
+	                      ${DRAMSYS_CONSTEXPR_MEMSPECS})
+
+	target_include_directories(${target_name} PRIVATE "${generated_dir}")
+	target_compile_definitions(${target_name} PRIVATE DRAMSYS_GENERATED_TIMINGS)
+endfunction()
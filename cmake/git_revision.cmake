@@ -0,0 +1,83 @@
+###############################################
+###            git_revision                 ###
+###############################################
+###
+### Writes the project version and the git revision
+### of the source tree into a header at build time,
+### so that the revision is updated by every build
+### and not only when CMake is reconfigured; the
+### revision of a dirty tree includes a hash of the
+### uncommitted changes
+###
+
+set(DRAMSYS_GIT_REVISION_SCRIPT "${CMAKE_CURRENT_LIST_FILE}")
+
+function( dramsys_git_revision target_name )
+	find_package(Git QUIET)
+	set(generated_dir "${CMAKE_CURRENT_BINARY_DIR}/generated")
+	set(output_file "${generated_dir}/DRAMSysVersion.h")
+
+	add_custom_target(${target_name}_git_revision
+		COMMAND ${CMAKE_COMMAND}
+			-DGIT_EXECUTABLE=${GIT_EXECUTABLE}
+			-DSOURCE_DIR=${CMAKE_CURRENT_SOURCE_DIR}
+			-DPROJECT_VERSION=${CMAKE_PROJECT_VERSION}
+			-DOUTPUT_FILE=${output_file}
+			-P ${DRAMSYS_GIT_REVISION_SCRIPT}
+		BYPRODUCTS "${output_file}"
+		COMMENT "Updating the git revision of ${target_name}"
+		VERBATIM
+	)
+
+	add_dependencies(${target_name} ${target_name}_git_revision)
+	target_include_directories(${target_name} PRIVATE "${generated_dir}")
+endfunction()
+
+# Script mode, called by the custom target during the build
+if(CMAKE_SCRIPT_MODE_FILE AND OUTPUT_FILE)
+	set(revision "")
+	if(GIT_EXECUTABLE)
+		execute_process(
+			COMMAND ${GIT_EXECUTABLE} describe --always --dirty
+			WORKING_DIRECTORY ${SOURCE_DIR}
+			OUTPUT_VARIABLE revision
+			OUTPUT_STRIP_TRAILING_WHITESPACE
+			ERROR_QUIET
+		)
+
+		# Every build from an uncommitted tree would otherwise report the same revision. Untracked
+		# sources do not make git describe report a dirty tree, so they are checked separately.
+		execute_process(
+			COMMAND ${GIT_EXECUTABLE} ls-files --others --exclude-standard -- src lib cmake CMakeLists.txt
+			WORKING_DIRECTORY ${SOURCE_DIR}
+			OUTPUT_VARIABLE untracked_files
+			OUTPUT_STRIP_TRAILING_WHITESPACE
+			ERROR_QUIET
+		)
+		if(revision MATCHES "-dirty$" OR untracked_files)
+			execute_process(
+				COMMAND ${GIT_EXECUTABLE} diff HEAD
+				WORKING_DIRECTORY ${SOURCE_DIR}
+				OUTPUT_VARIABLE changes
+				ERROR_QUIET
+			)
+			string(REPLACE "\n" ";" untracked_files "${untracked_files}")
+			foreach(untracked_file IN LISTS untracked_files)
+				file(SHA1 "${SOURCE_DIR}/${untracked_file}" untracked_hash)
+				string(APPEND changes "${untracked_file} ${untracked_hash}\n")
+			endforeach()
+			string(SHA1 changes_hash "${changes}")
+			string(SUBSTRING "${changes_hash}" 0 12 changes_hash)
+			if(NOT revision MATCHES "-dirty$")
+				string(APPEND revision "-dirty")
+			endif()
+			string(APPEND revision "-${changes_hash}")
+		endif()
+	endif()
+
+	set(content "// Generated by cmake/git_revision.cmake, do not edit\n\n#pragma once\n\n")
+	string(APPEND content "#define DRAMSYS_VERSION \"${PROJECT_VERSION}-${revision}\"\n")
+
+	# Only touch the header if the revision changed, otherwise every build would recompile main.cpp
+	file(CONFIGURE OUTPUT "${OUTPUT_FILE}" CONTENT "${content}" @ONLY)
+endif()
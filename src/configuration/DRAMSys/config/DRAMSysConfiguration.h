@@ -38,6 +38,7 @@
 
 #include "DRAMSys/config/AddressMapping.h"
 #include "DRAMSys/config/McConfig.h"
+#include "DRAMSys/config/MemoryTier.h"
 #include "DRAMSys/config/SimConfig.h"
 #include "DRAMSys/config/TraceSetup.h"
 #include "DRAMSys/config/memspec/MemSpec.h"
@@ -69,6 +70,8 @@ struct Configuration
     SimConfig simconfig;
     std::string simulationid;
     std::optional<TraceSetup> tracesetup;
+    std::optional<std::vector<MemoryTier>> tiers;
+    std::optional<TierMigration> migration;
 };
 
 NLOHMANN_JSONIFY_ALL_THINGS(Configuration,
@@ -77,7 +80,9 @@ NLOHMANN_JSONIFY_ALL_THINGS(Configuration,
                             memspec,
                             simconfig,
                             simulationid,
-                            tracesetup)
+                            tracesetup,
+                            tiers,
+                            migration)
 
 Configuration from_path(std::string_view path, std::string_view resourceDirectory = DRAMSYS_RESOURCE_DIR);
 
@@ -69,6 +69,8 @@ enum class SchedulerType
     FrFcfsGrp,
     GrpFrFcfs,
     GrpFrFcfsWm,
+    Edf,
+    ReadPriority,
     Invalid = -1
 };
 
@@ -77,7 +79,9 @@ NLOHMANN_JSON_SERIALIZE_ENUM(SchedulerType, {{SchedulerType::Invalid, nullptr},
                                          {SchedulerType::FrFcfs, "FrFcfs"},
                                          {SchedulerType::FrFcfsGrp, "FrFcfsGrp"},
                                          {SchedulerType::GrpFrFcfs, "GrpFrFcfs"},
-                                         {SchedulerType::GrpFrFcfsWm, "GrpFrFcfsWm"}})
+                                         {SchedulerType::GrpFrFcfsWm, "GrpFrFcfsWm"},
+                                         {SchedulerType::Edf, "Edf"},
+                                         {SchedulerType::ReadPriority, "ReadPriority"}})
 
 enum class SchedulerBufferType
 {
@@ -96,11 +100,13 @@ enum class CmdMuxType
 {
     Oldest,
     Strict,
+    BankGroup,
     Invalid = -1
 };
 
 NLOHMANN_JSON_SERIALIZE_ENUM(CmdMuxType,
-                             {{CmdMuxType::Invalid, nullptr}, {CmdMuxType::Oldest, "Oldest"}, {CmdMuxType::Strict, "Strict"}})
+                             {{CmdMuxType::Invalid, nullptr}, {CmdMuxType::Oldest, "Oldest"}, {CmdMuxType::Strict, "Strict"},
+                              {CmdMuxType::BankGroup, "BankGroup"}})
 
 enum class RespQueueType
 {
@@ -120,6 +126,7 @@ enum class RefreshPolicyType
     PerBank,
     Per2Bank,
     SameBank,
+    Retention,
     Invalid = -1
 };
 
@@ -129,6 +136,7 @@ NLOHMANN_JSON_SERIALIZE_ENUM(RefreshPolicyType, {{RefreshPolicyType::Invalid, nu
                                                {RefreshPolicyType::PerBank, "PerBank"},
                                                {RefreshPolicyType::Per2Bank, "Per2Bank"},
                                                {RefreshPolicyType::SameBank, "SameBank"},
+                                               {RefreshPolicyType::Retention, "Retention"},
 
                                                // Alternative conversions to provide backwards-compatibility
                                                // when deserializing. Will not be used for serializing.
@@ -169,17 +177,30 @@ struct McConfig
     std::optional<SchedulerType> Scheduler;
     std::optional<unsigned int> HighWatermark;
     std::optional<unsigned int> LowWatermark;
+    std::optional<unsigned int> DeadlineSlack;
+    std::optional<unsigned int> WriteBatchSize;
+    std::optional<bool> WriteCancellation;
+    std::optional<unsigned int> WriteRestartPenalty;
     std::optional<SchedulerBufferType> SchedulerBuffer;
     std::optional<unsigned int> RequestBufferSize;
+    std::optional<unsigned int> IngressQueueSize;
     std::optional<CmdMuxType> CmdMux;
+    std::optional<unsigned int> BankGroupStarvationLimit;
     std::optional<RespQueueType> RespQueue;
     std::optional<RefreshPolicyType> RefreshPolicy;
     std::optional<unsigned int> RefreshMaxPostponed;
     std::optional<unsigned int> RefreshMaxPulledin;
+    std::optional<std::string> RetentionProfile;
+    std::optional<uint64_t> RetentionSeed;
+    std::optional<unsigned int> RetentionRefreshWindow;
     std::optional<PowerDownPolicyType> PowerDownPolicy;
+    std::optional<unsigned int> PowerDownBatchDelay;
+    std::optional<unsigned int> PowerDownBatchSize;
+    std::optional<unsigned int> PowerDownBatchDepth;
     std::optional<ArbiterType> Arbiter;
     std::optional<unsigned int> MaxActiveTransactions;
     std::optional<bool> RefreshManagement;
+    std::optional<bool> SubarrayLevelParallelism;
     std::optional<unsigned int> ArbitrationDelayFw;
     std::optional<unsigned int> ArbitrationDelayBw;
     std::optional<unsigned int> ThinkDelayFw;
@@ -195,17 +216,30 @@ NLOHMANN_JSONIFY_ALL_THINGS(McConfig,
                             Scheduler,
                             HighWatermark,
                             LowWatermark,
+                            DeadlineSlack,
+                            WriteBatchSize,
+                            WriteCancellation,
+                            WriteRestartPenalty,
                             SchedulerBuffer,
                             RequestBufferSize,
+                            IngressQueueSize,
                             CmdMux,
+                            BankGroupStarvationLimit,
                             RespQueue,
                             RefreshPolicy,
                             RefreshMaxPostponed,
                             RefreshMaxPulledin,
+                            RetentionProfile,
+                            RetentionSeed,
+                            RetentionRefreshWindow,
                             PowerDownPolicy,
+                            PowerDownBatchDelay,
+                            PowerDownBatchSize,
+                            PowerDownBatchDepth,
                             Arbiter,
                             MaxActiveTransactions,
                             RefreshManagement,
+                            SubarrayLevelParallelism,
                             ArbitrationDelayFw,
                             ArbitrationDelayBw,
                             ThinkDelayFw,
@@ -30,46 +30,43 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  * Authors:
- *    Matthias Jung
  *    Derek Christ
  */
 
-#include "util.h"
+#ifndef DRAMSYSCONFIGURATION_MEMORYTIER_H
+#define DRAMSYSCONFIGURATION_MEMORYTIER_H
 
-#include <cmath>
-#include <iomanip>
-#include <iostream>
+#include "DRAMSys/util/json.h"
 
-void loadBar(uint64_t x, uint64_t n, unsigned int w, unsigned int granularity)
+#include <optional>
+#include <string>
+
+namespace DRAMSys::Config
+{
+
+// Additional memory subsystem behind an address range, the memory of the main configuration is
+// the first tier starting at address 0
+struct MemoryTier
+{
+    std::string config;
+    uint64_t base;
+    std::optional<uint64_t> offset;
+};
+
+NLOHMANN_JSONIFY_ALL_THINGS(MemoryTier, config, base, offset)
+
+// Hot page promotion into the first tier
+struct TierMigration
 {
-    if ((n < 100) || ((x != n) && (x % (n / 100 * granularity) != 0)))
-        return;
+    uint64_t epochNs;
+    std::optional<unsigned int> pageSize;
+    std::optional<unsigned int> threshold;
+    std::optional<unsigned int> tableSize;
+    std::optional<unsigned int> pagesPerEpoch;
+};
 
-    float ratio = x / (float)n;
-    unsigned int c = (ratio * w);
-    float rest = (ratio * w) - c;
-    std::cout << std::setw(3) << std::round(ratio * 100) << "% |";
-    for (unsigned int x = 0; x < c; x++)
-        std::cout << "█";
+NLOHMANN_JSONIFY_ALL_THINGS(TierMigration, epochNs, pageSize, threshold, tableSize, pagesPerEpoch)
 
-    if (rest >= 0 && rest < 0.125f && c != w)
-        std::cout << " ";
-    if (rest >= 0.125f && rest < 2 * 0.125f)
-        std::cout << "▏";
-    if (rest >= 2 * 0.125f && rest < 3 * 0.125f)
-        std::cout << "▎";
-    if (rest >= 3 * 0.125f && rest < 4 * 0.125f)
-        std::cout << "▍";
-    if (rest >= 4 * 0.125f && rest < 5 * 0.125f)
-        std::cout << "▌";
-    if (rest >= 5 * 0.125f && rest < 6 * 0.125f)
-        std::cout << "▋";
-    if (rest >= 6 * 0.125f && rest < 7 * 0.125f)
-        std::cout << "▊";
-    if (rest >= 7 * 0.125f && rest < 8 * 0.125f)
-        std::cout << "▉";
+} // namespace DRAMSys::Config
 
-    for (unsigned int x = c; x < (w - 1); x++)
-        std::cout << " ";
-    std::cout << "|\r" << std::flush;
-}
+#endif // DRAMSYSCONFIGURATION_MEMORYTIER_H
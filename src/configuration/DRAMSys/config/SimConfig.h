@@ -56,6 +56,22 @@ NLOHMANN_JSON_SERIALIZE_ENUM(StoreModeType, {{StoreModeType::Invalid, nullptr},
                                          {StoreModeType::Store, "Store"},
                                          {StoreModeType::ErrorModel, "ErrorModel"}})
 
+enum class PageTranslationType
+{
+    Sequential,
+    Random,
+    BankColored,
+    ChannelPartitioned,
+    Invalid = -1
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(PageTranslationType,
+                             {{PageTranslationType::Invalid, nullptr},
+                              {PageTranslationType::Sequential, "Sequential"},
+                              {PageTranslationType::Random, "Random"},
+                              {PageTranslationType::BankColored, "BankColored"},
+                              {PageTranslationType::ChannelPartitioned, "ChannelPartitioned"}})
+
 struct SimConfig
 {
     static constexpr std::string_view KEY = "simconfig";
@@ -63,15 +79,27 @@ struct SimConfig
 
     std::optional<uint64_t> AddressOffset;
     std::optional<bool> CheckTLM2Protocol;
+    std::optional<unsigned int> CheckTLM2ProtocolSampling;
+    std::optional<unsigned int> CommandFingerprintInterval;
+    std::optional<bool> DataBusStatistics;
+    std::optional<double> DataBusToggleEnergy;
+    std::optional<double> DataBusZeroEnergy;
     std::optional<bool> DatabaseRecording;
+    std::optional<unsigned int> DatabaseSchemaVersion;
     std::optional<bool> Debug;
     std::optional<bool> EnableWindowing;
     std::optional<std::string> ErrorCSVFile;
+    std::optional<unsigned int> EventLogSize;
     std::optional<unsigned int> ErrorChipSeed;
+    std::optional<unsigned int> PageSize;
+    std::optional<PageTranslationType> PageTranslation;
+    std::optional<uint64_t> PageTranslationSeed;
     std::optional<bool> PowerAnalysis;
+    std::optional<std::string> ResultCache;
     std::optional<std::string> SimulationName;
     std::optional<bool> SimulationProgressBar;
     std::optional<StoreModeType> StoreMode;
+    std::optional<unsigned int> TelemetryInterval;
     std::optional<bool> ThermalSimulation;
     std::optional<bool> UseMalloc;
     std::optional<unsigned int> WindowSize;
@@ -80,15 +108,27 @@ struct SimConfig
 NLOHMANN_JSONIFY_ALL_THINGS(SimConfig,
                             AddressOffset,
                             CheckTLM2Protocol,
+                            CheckTLM2ProtocolSampling,
+                            CommandFingerprintInterval,
+                            DataBusStatistics,
+                            DataBusToggleEnergy,
+                            DataBusZeroEnergy,
                             DatabaseRecording,
+                            DatabaseSchemaVersion,
                             Debug,
                             EnableWindowing,
                             ErrorCSVFile,
+                            EventLogSize,
                             ErrorChipSeed,
+                            PageSize,
+                            PageTranslation,
+                            PageTranslationSeed,
                             PowerAnalysis,
+                            ResultCache,
                             SimulationName,
                             SimulationProgressBar,
                             StoreMode,
+                            TelemetryInterval,
                             ThermalSimulation,
                             UseMalloc,
                             WindowSize)
@@ -74,10 +74,11 @@ struct TracePlayer
     std::string name;
     std::optional<unsigned int> maxPendingReadRequests;
     std::optional<unsigned int> maxPendingWriteRequests;
+    std::optional<unsigned int> latencyBudgetNs;
 };
 
 NLOHMANN_JSONIFY_ALL_THINGS(
-    TracePlayer, clkMhz, name, maxPendingReadRequests, maxPendingWriteRequests)
+    TracePlayer, clkMhz, name, maxPendingReadRequests, maxPendingWriteRequests, latencyBudgetNs)
 
 struct TrafficGeneratorActiveState
 {
@@ -124,6 +125,7 @@ struct TrafficGenerator
     std::string name;
     std::optional<unsigned int> maxPendingReadRequests;
     std::optional<unsigned int> maxPendingWriteRequests;
+    std::optional<unsigned int> latencyBudgetNs;
 
     std::optional<uint64_t> seed;
     std::optional<uint64_t> maxTransactions;
@@ -143,6 +145,7 @@ NLOHMANN_JSONIFY_ALL_THINGS(TrafficGenerator,
                             name,
                             maxPendingReadRequests,
                             maxPendingWriteRequests,
+                            latencyBudgetNs,
                             seed,
                             maxTransactions,
                             dataLength,
@@ -160,6 +163,7 @@ struct TrafficGeneratorStateMachine
     std::string name;
     std::optional<unsigned int> maxPendingReadRequests;
     std::optional<unsigned int> maxPendingWriteRequests;
+    std::optional<unsigned int> latencyBudgetNs;
 
     std::optional<uint64_t> seed;
     std::optional<uint64_t> maxTransactions;
@@ -174,6 +178,7 @@ NLOHMANN_JSONIFY_ALL_THINGS(TrafficGeneratorStateMachine,
                             name,
                             maxPendingReadRequests,
                             maxPendingWriteRequests,
+                            latencyBudgetNs,
                             seed,
                             maxTransactions,
                             dataLength,
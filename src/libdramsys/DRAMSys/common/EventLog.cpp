@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "EventLog.h"
+
+#include "DRAMSys/controller/Command.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <utility>
+#include <systemc>
+
+#ifdef _WIN32
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+static constexpr char DUMP_MAGIC[8] = {'D', 'S', 'Y', 'S', 'E', 'V', 'T', '1'};
+
+static const char* eventName(uint32_t event)
+{
+    switch (static_cast<EventLog::Event>(event))
+    {
+    case EventLog::Event::ArbiterBeginReq:
+        return "ArbiterBeginReq";
+    case EventLog::Event::ArbiterBeginResp:
+        return "ArbiterBeginResp";
+    case EventLog::Event::ControllerBeginReq:
+        return "ControllerBeginReq";
+    case EventLog::Event::ControllerCommand:
+        return "ControllerCommand";
+    case EventLog::Event::ControllerBeginResp:
+        return "ControllerBeginResp";
+    default:
+        return "Unknown";
+    }
+}
+
+static uint64_t roundUpToPowerOfTwo(unsigned value)
+{
+    uint64_t result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+// The instance ID is never reused, so a cached buffer of a destroyed log can not be mistaken for one
+// of a new log that happens to be allocated at the same address.
+static std::atomic<uint64_t> nextInstanceID{0};
+
+EventLog::EventLog(unsigned entriesPerThread, std::string dumpFileName) :
+    id(nextInstanceID.fetch_add(1, std::memory_order_relaxed)),
+    // round up to the next power of two so that the ring buffer index is a simple mask
+    bufferSize(roundUpToPowerOfTwo(std::max(entriesPerThread, 1U))),
+    fileName(std::move(dumpFileName))
+{
+}
+
+uint32_t EventLog::registerOrigin(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    origins.push_back(name);
+    return static_cast<uint32_t>(origins.size() - 1);
+}
+
+EventLog::RingBuffer& EventLog::localBuffer()
+{
+    // Each thread caches its buffers of all logs it has recorded into, there are only a few logs
+    // (one per DRAMSys instance) so a linear search is sufficient.
+    struct CachedBuffer
+    {
+        uint64_t log;
+        RingBuffer* buffer;
+    };
+    static thread_local std::vector<CachedBuffer> cachedBuffers;
+
+    for (const auto& [log, buffer] : cachedBuffers)
+    {
+        if (log == id)
+            return *buffer;
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    buffers.emplace_back(std::make_unique<RingBuffer>(bufferSize));
+    cachedBuffers.push_back({id, buffers.back().get()});
+    return *buffers.back();
+}
+
+void EventLog::record(uint32_t origin, Event event, uint64_t argument0, uint64_t argument1, uint64_t argument2)
+{
+    RingBuffer& buffer = localBuffer();
+
+    // single writer per buffer, the release store only orders the entry before the new head for a reader
+    uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    Entry& entry = buffer.entries[head & buffer.mask];
+    entry.time = sc_time_stamp().value();
+    entry.event = static_cast<uint32_t>(event);
+    entry.origin = origin;
+    entry.arguments[0] = argument0;
+    entry.arguments[1] = argument1;
+    entry.arguments[2] = argument2;
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+// Only uses functions that are safe to call from a signal handler (no allocation, no stdio).
+bool EventLog::dump() const
+{
+    const char* dumpFileName = fileName.c_str();
+
+#ifdef _WIN32
+    int fd = _open(dumpFileName, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+    auto writeBytes = [fd](const void* data, std::size_t size)
+    { return _write(fd, data, static_cast<unsigned>(size)) == static_cast<int>(size); };
+#else
+    int fd = ::open(dumpFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    auto writeBytes = [fd](const void* data, std::size_t size)
+    { return ::write(fd, data, size) == static_cast<ssize_t>(size); };
+#endif
+    if (fd < 0)
+        return false;
+
+    auto numberOfOrigins = static_cast<uint32_t>(origins.size());
+    auto numberOfBuffers = static_cast<uint32_t>(buffers.size());
+    bool success = writeBytes(DUMP_MAGIC, sizeof(DUMP_MAGIC))
+                   && writeBytes(&numberOfOrigins, sizeof(numberOfOrigins))
+                   && writeBytes(&numberOfBuffers, sizeof(numberOfBuffers));
+
+    for (uint32_t i = 0; success && i < numberOfOrigins; i++)
+    {
+        auto length = static_cast<uint32_t>(origins[i].size());
+        success = writeBytes(&length, sizeof(length)) && writeBytes(origins[i].data(), length);
+    }
+
+    for (uint32_t i = 0; success && i < numberOfBuffers; i++)
+    {
+        const RingBuffer& buffer = *buffers[i];
+        uint64_t head = buffer.head.load(std::memory_order_acquire);
+        uint64_t size = buffer.mask + 1;
+        uint64_t numberOfEntries = std::min(head, size);
+        uint64_t first = head - numberOfEntries;
+
+        success = writeBytes(&numberOfEntries, sizeof(numberOfEntries));
+
+        // oldest entries first, the ring buffer may wrap around once
+        uint64_t firstIndex = first & buffer.mask;
+        uint64_t firstChunk = std::min(numberOfEntries, size - firstIndex);
+        success = success && writeBytes(&buffer.entries[firstIndex], firstChunk * sizeof(Entry))
+                  && writeBytes(buffer.entries.data(), (numberOfEntries - firstChunk) * sizeof(Entry));
+    }
+
+#ifdef _WIN32
+    _close(fd);
+#else
+    ::close(fd);
+#endif
+    return success;
+}
+
+bool EventLog::decode(const std::string& dumpFileName, std::ostream& output)
+{
+    std::ifstream file(dumpFileName, std::ios::binary);
+    if (!file)
+        return false;
+
+    char magic[sizeof(DUMP_MAGIC)];
+    uint32_t numberOfOrigins = 0;
+    uint32_t numberOfBuffers = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&numberOfOrigins), sizeof(numberOfOrigins));
+    file.read(reinterpret_cast<char*>(&numberOfBuffers), sizeof(numberOfBuffers));
+    if (!file || std::memcmp(magic, DUMP_MAGIC, sizeof(DUMP_MAGIC)) != 0)
+        return false;
+
+    std::vector<std::string> originNames(numberOfOrigins);
+    for (auto& name : originNames)
+    {
+        uint32_t length = 0;
+        file.read(reinterpret_cast<char*>(&length), sizeof(length));
+        name.resize(length);
+        file.read(name.data(), length);
+    }
+
+    struct ThreadEntry
+    {
+        uint32_t thread;
+        Entry entry;
+    };
+    std::vector<ThreadEntry> entries;
+
+    for (uint32_t thread = 0; thread < numberOfBuffers && file; thread++)
+    {
+        uint64_t numberOfEntries = 0;
+        file.read(reinterpret_cast<char*>(&numberOfEntries), sizeof(numberOfEntries));
+        for (uint64_t i = 0; i < numberOfEntries && file; i++)
+        {
+            ThreadEntry threadEntry{thread, {}};
+            file.read(reinterpret_cast<char*>(&threadEntry.entry), sizeof(Entry));
+            entries.push_back(threadEntry);
+        }
+    }
+
+    if (!file)
+        return false;
+
+    std::stable_sort(entries.begin(), entries.end(), [](const ThreadEntry& lhs, const ThreadEntry& rhs)
+                     { return lhs.entry.time < rhs.entry.time; });
+
+    for (const auto& [thread, entry] : entries)
+    {
+        output << std::setw(16) << sc_time::from_value(entry.time).to_string()
+               << "  T" << thread << "  "
+               << std::left << std::setw(24)
+               << (entry.origin < originNames.size() ? originNames[entry.origin] : std::to_string(entry.origin))
+               << std::setw(22) << eventName(entry.event) << std::right;
+
+        if (static_cast<Event>(entry.event) == Event::ControllerCommand && entry.arguments[0] < Command::END_ENUM)
+            output << Command(static_cast<Command::Type>(entry.arguments[0])).toString();
+        else
+            output << entry.arguments[0];
+
+        output << " " << entry.arguments[1] << " " << entry.arguments[2] << std::endl;
+    }
+
+    return true;
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// In contrast to PRINTDEBUGMESSAGE this macro is also active in release builds. If the module has no
+// event log only a single branch is executed, so the arguments are not evaluated.
+#define LOGEVENT(log, origin, event, ...) \
+    do { if ((log) != nullptr) (log)->record(origin, event, __VA_ARGS__); } while (false)
+
+namespace DRAMSys
+{
+
+// Binary event log with one lock-free ring buffer per thread. Each entry consists of the simulation
+// time, an event ID, the ID of the recording module and three integer arguments. Every DRAMSys
+// instance owns its own log. The content is written to a binary file on demand and can be decoded
+// later. The library does not install any handlers, it is up to the application to call dump(), e.g.
+// on a fatal SC_REPORT or from a signal handler (dump() does not allocate memory).
+class EventLog
+{
+public:
+    enum class Event : uint32_t
+    {
+        ArbiterBeginReq,     // thread, channel, address
+        ArbiterBeginResp,    // thread, channel, thread payload ID
+        ControllerBeginReq,  // channel payload ID, bank, row
+        ControllerCommand,   // command, bank, channel payload ID
+        ControllerBeginResp, // address, data length
+        END_ENUM
+    };
+
+    EventLog(unsigned entriesPerThread, std::string dumpFileName);
+    EventLog(const EventLog&) = delete;
+    EventLog& operator=(const EventLog&) = delete;
+
+    uint32_t registerOrigin(const std::string& name);
+    void record(uint32_t origin, Event event, uint64_t argument0 = 0, uint64_t argument1 = 0,
+                uint64_t argument2 = 0);
+
+    bool dump() const;
+    [[nodiscard]] const std::string& getFileName() const { return fileName; }
+
+    static bool decode(const std::string& dumpFileName, std::ostream& output);
+
+private:
+    struct Entry
+    {
+        uint64_t time;
+        uint32_t event;
+        uint32_t origin;
+        uint64_t arguments[3];
+    };
+
+    struct RingBuffer
+    {
+        explicit RingBuffer(uint64_t size) : entries(size), mask(size - 1) {}
+        std::vector<Entry> entries;
+        const uint64_t mask;
+        std::atomic<uint64_t> head{0};
+    };
+
+    RingBuffer& localBuffer();
+
+    const uint64_t id;
+    const uint64_t bufferSize;
+    const std::string fileName;
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<RingBuffer>> buffers;
+    std::vector<std::string> origins;
+};
+
+} // namespace DRAMSys
+
+#endif // EVENTLOG_H
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef PAYLOADTABLE_H
+#define PAYLOADTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <tlm>
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Flat open addressing hash table keyed by the payload address with linear probing. The load
+// factor is kept below one half, erase uses backward shift deletion so that the probe sequences
+// stay intact without tombstones.
+template <typename Value>
+class PayloadTable
+{
+public:
+    // The initial capacity has to be a power of two
+    explicit PayloadTable(std::size_t initialCapacity = 64) : table(initialCapacity), mask(initialCapacity - 1) {}
+
+    // Returns nullptr if the payload is not contained
+    Value* find(const tlm::tlm_generic_payload* trans)
+    {
+        for (std::size_t index = slot(trans); table[index].trans != nullptr; index = (index + 1) & mask)
+        {
+            if (table[index].trans == trans)
+                return &table[index].value;
+        }
+        return nullptr;
+    }
+
+    // The payload must not be contained yet
+    Value& insert(const tlm::tlm_generic_payload* trans)
+    {
+        if (2 * (entries + 1) > table.size())
+            grow();
+
+        std::size_t index = slot(trans);
+        while (table[index].trans != nullptr)
+            index = (index + 1) & mask;
+
+        entries++;
+        table[index].trans = trans;
+        table[index].value = Value();
+        return table[index].value;
+    }
+
+    void erase(const tlm::tlm_generic_payload* trans)
+    {
+        std::size_t hole = slot(trans);
+        while (table[hole].trans != trans)
+        {
+            if (table[hole].trans == nullptr)
+                return;
+            hole = (hole + 1) & mask;
+        }
+
+        // An entry can fill the hole if its home slot does not lie cyclically in (hole, index]
+        for (std::size_t index = (hole + 1) & mask; table[index].trans != nullptr; index = (index + 1) & mask)
+        {
+            std::size_t home = slot(table[index].trans);
+            if (((index - home) & mask) >= ((index - hole) & mask))
+            {
+                table[hole] = table[index];
+                hole = index;
+            }
+        }
+
+        table[hole] = Slot();
+        entries--;
+    }
+
+    [[nodiscard]] std::size_t size() const { return entries; }
+    [[nodiscard]] std::size_t capacity() const { return table.size(); }
+
+private:
+    struct Slot
+    {
+        const tlm::tlm_generic_payload* trans = nullptr;
+        Value value{};
+    };
+
+    [[nodiscard]] std::size_t slot(const tlm::tlm_generic_payload* trans) const
+    {
+        // Payloads are heap objects, so the low bits carry no information
+        auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(trans));
+        return static_cast<std::size_t>((key >> 4) * UINT64_C(0x9e3779b97f4a7c15) >> 32) & mask;
+    }
+
+    void grow()
+    {
+        std::vector<Slot> oldTable(2 * table.size());
+        std::swap(table, oldTable);
+        mask = table.size() - 1;
+        for (const Slot& entry : oldTable)
+        {
+            if (entry.trans == nullptr)
+                continue;
+
+            std::size_t index = slot(entry.trans);
+            while (table[index].trans != nullptr)
+                index = (index + 1) & mask;
+            table[index] = entry;
+        }
+    }
+
+    std::vector<Slot> table;
+    std::size_t mask;
+    std::size_t entries = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // PAYLOADTABLE_H
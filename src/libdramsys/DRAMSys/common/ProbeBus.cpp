@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "ProbeBus.h"
+
+namespace DRAMSys
+{
+
+ProbeBus::ProbeBus(std::size_t batchSize) : batchSize(batchSize == 0 ? 1 : batchSize)
+{
+    batch.reserve(this->batchSize);
+}
+
+void ProbeBus::subscribe(ProbeListener& listener, std::initializer_list<ProbeEvent::Type> types)
+{
+    uint32_t mask = 0;
+    for (auto type : types)
+        mask |= 1U << static_cast<unsigned>(type);
+
+    subscriptions.push_back({&listener, mask});
+    subscribedTypes |= mask;
+}
+
+void ProbeBus::flush()
+{
+    if (batch.empty())
+        return;
+
+    for (auto& subscription : subscriptions)
+    {
+        if (subscription.types == subscribedTypes)
+        {
+            subscription.listener->notify(batch);
+            continue;
+        }
+
+        filteredBatch.clear();
+        for (const auto& event : batch)
+        {
+            if ((subscription.types >> static_cast<unsigned>(event.type) & 1U) != 0)
+                filteredBatch.push_back(event);
+        }
+
+        if (!filteredBatch.empty())
+            subscription.listener->notify(filteredBatch);
+    }
+
+    batch.clear();
+}
+
+} // namespace DRAMSys
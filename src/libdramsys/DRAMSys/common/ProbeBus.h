@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef PROBEBUS_H
+#define PROBEBUS_H
+
+#include "DRAMSys/controller/Command.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <systemc>
+#include <tlm>
+#include <vector>
+
+namespace DRAMSys
+{
+
+struct ProbeEvent
+{
+    enum class Type : uint8_t
+    {
+        RequestAccepted,   // arbiter: BEGIN_REQ of a thread, controller: request stored in the scheduler
+        CommandIssued,     // controller
+        ResponseSent,      // arbiter and controller: BEGIN_RESP
+        PowerStateChanged, // DRAM: power-down or self-refresh entry and exit
+        END_ENUM
+    };
+
+    enum class PowerState : uint8_t
+    {
+        Active,
+        ActivePowerDown,
+        PrechargePowerDown,
+        SelfRefresh
+    };
+
+    ProbeEvent(Type type, const sc_core::sc_object* origin, const sc_core::sc_time& time)
+        : type(type), origin(origin), time(time)
+    {
+    }
+
+    // Events are delivered in batches, possibly after the payload has been released, so the fields
+    // of the payload are copied instead of keeping a pointer to it
+    ProbeEvent(Type type, const sc_core::sc_object* origin, const sc_core::sc_time& time,
+               const tlm::tlm_generic_payload& payload)
+        : type(type), origin(origin), time(time), address(payload.get_address()),
+          dataLength(payload.get_data_length()), tlmCommand(payload.get_command())
+    {
+    }
+
+    Type type;
+    const sc_core::sc_object* origin;
+    sc_core::sc_time time;
+    uint64_t address = 0;
+    unsigned int dataLength = 0;
+    tlm::tlm_command tlmCommand = tlm::TLM_IGNORE_COMMAND;
+    unsigned int thread = 0;
+    unsigned int channel = 0;
+    unsigned int rank = 0;
+    unsigned int bank = 0;
+    Command command = Command::NOP;
+    PowerState powerState = PowerState::Active;
+};
+
+class ProbeListener
+{
+public:
+    virtual ~ProbeListener() = default;
+
+    // Called with the events of all subscribed types in the order of their publication
+    virtual void notify(const std::vector<ProbeEvent>& events) = 0;
+};
+
+// Delivers the events of one DRAMSys instance in batches, unsubscribed types cost a single branch
+class ProbeBus
+{
+public:
+    explicit ProbeBus(std::size_t batchSize = 1024);
+
+    void subscribe(ProbeListener& listener, std::initializer_list<ProbeEvent::Type> types);
+
+    bool isSubscribed(ProbeEvent::Type type) const
+    {
+        return (subscribedTypes >> static_cast<unsigned>(type) & 1U) != 0;
+    }
+
+    void publish(const ProbeEvent& event)
+    {
+        batch.push_back(event);
+        if (batch.size() >= batchSize)
+            flush();
+    }
+
+    // Delivers the pending events, called at the end of the simulation
+    void flush();
+
+private:
+    struct Subscription
+    {
+        ProbeListener* listener;
+        uint32_t types;
+    };
+
+    const std::size_t batchSize;
+    uint32_t subscribedTypes = 0;
+    std::vector<Subscription> subscriptions;
+    std::vector<ProbeEvent> batch;
+    std::vector<ProbeEvent> filteredBatch;
+};
+
+} // namespace DRAMSys
+
+#endif // PROBEBUS_H
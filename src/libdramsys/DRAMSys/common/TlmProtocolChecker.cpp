@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "TlmProtocolChecker.h"
+
+#include <sstream>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+TlmProtocolChecker::TlmProtocolChecker(const sc_module_name& name, unsigned samplingRate) :
+    sc_module(name), samplingRate(samplingRate)
+{
+    target_socket.bind(*this);
+    initiator_socket.bind(*this);
+}
+
+tlm_sync_enum TlmProtocolChecker::nb_transport_fw(tlm_generic_payload& trans, tlm_phase& phase, sc_time& delay)
+{
+    checkForward(trans, phase, delay);
+
+    tlm_sync_enum status = initiator_socket->nb_transport_fw(trans, phase, delay);
+
+    if (status == TLM_UPDATED)
+        checkBackward(trans, phase, delay);
+    else if (status == TLM_COMPLETED)
+        completeTransaction(trans);
+
+    return status;
+}
+
+tlm_sync_enum TlmProtocolChecker::nb_transport_bw(tlm_generic_payload& trans, tlm_phase& phase, sc_time& delay)
+{
+    checkBackward(trans, phase, delay);
+
+    tlm_sync_enum status = target_socket->nb_transport_bw(trans, phase, delay);
+
+    if (status == TLM_UPDATED)
+        checkForward(trans, phase, delay);
+    else if (status == TLM_COMPLETED)
+        completeTransaction(trans);
+
+    return status;
+}
+
+void TlmProtocolChecker::b_transport(tlm_generic_payload& trans, sc_time& delay)
+{
+    initiator_socket->b_transport(trans, delay);
+}
+
+bool TlmProtocolChecker::get_direct_mem_ptr(tlm_generic_payload& trans, tlm_dmi& dmiData)
+{
+    return initiator_socket->get_direct_mem_ptr(trans, dmiData);
+}
+
+void TlmProtocolChecker::invalidate_direct_mem_ptr(sc_dt::uint64 startRange, sc_dt::uint64 endRange)
+{
+    target_socket->invalidate_direct_mem_ptr(startRange, endRange);
+}
+
+unsigned int TlmProtocolChecker::transport_dbg(tlm_generic_payload& trans)
+{
+    return initiator_socket->transport_dbg(trans);
+}
+
+void TlmProtocolChecker::checkForward(tlm_generic_payload& trans, const tlm_phase& phase, const sc_time& delay)
+{
+    if (phase == BEGIN_REQ)
+    {
+        if (!trans.has_mm())
+            error(trans, "Transaction passed to nb_transport_fw with no memory manager set", "14.5 i)");
+        if (trans.get_ref_count() == 0)
+            error(trans, "Transaction passed to nb_transport_fw with reference count of 0", "14.5 t)");
+        if (requestInProgress != nullptr)
+            error(trans, "Transaction violates BEGIN_REQ exclusion rule", "15.2.6 e)");
+        requestInProgress = &trans;
+
+        if (sampledTransactions.find(&trans) != nullptr)
+            error(trans, "Phase BEGIN_REQ sent for a transaction that is still in progress", "15.2.4");
+
+        if (requestCounter++ % samplingRate == 0)
+        {
+            Entry& entry = sampledTransactions.insert(&trans);
+            entry.phase = Phase::BeginReq;
+            entry.time = sc_time_stamp() + delay;
+        }
+    }
+    else if (phase == END_RESP)
+    {
+        if (responseInProgress != &trans)
+            error(trans, "Phase END_RESP sent out-of-sequence on forward path", "15.2.4");
+
+        if (Entry* entry = sampledTransactions.find(&trans))
+            checkTiming(trans, *entry, delay, "nb_transport_fw");
+
+        completeTransaction(trans);
+    }
+    else if (phase == END_REQ || phase == BEGIN_RESP)
+    {
+        error(trans, "Phase " + std::string(phase.get_name()) + " sent on forward path", "15.2.3 c)");
+    }
+}
+
+void TlmProtocolChecker::checkBackward(tlm_generic_payload& trans, const tlm_phase& phase, const sc_time& delay)
+{
+    if (phase == END_REQ)
+    {
+        if (requestInProgress != &trans)
+            error(trans, "Phase END_REQ sent out-of-sequence on backward path", "15.2.4");
+        requestInProgress = nullptr;
+
+        if (Entry* entry = sampledTransactions.find(&trans))
+        {
+            if (entry->phase != Phase::BeginReq)
+                error(trans, "Phase END_REQ sent out-of-sequence on backward path", "15.2.4");
+            entry->phase = Phase::EndReq;
+            checkTiming(trans, *entry, delay, "nb_transport_bw");
+        }
+    }
+    else if (phase == BEGIN_RESP)
+    {
+        if (responseInProgress != nullptr)
+            error(trans, "Transaction violates BEGIN_RESP exclusion rule", "15.2.6 f)");
+        responseInProgress = &trans;
+
+        // BEGIN_RESP implies END_REQ
+        if (requestInProgress == &trans)
+            requestInProgress = nullptr;
+
+        if (Entry* entry = sampledTransactions.find(&trans))
+        {
+            if (entry->phase == Phase::BeginResp)
+                error(trans, "Phase BEGIN_RESP sent out-of-sequence on backward path", "15.2.4");
+            entry->phase = Phase::BeginResp;
+            checkTiming(trans, *entry, delay, "nb_transport_bw");
+        }
+    }
+    else if (phase == BEGIN_REQ || phase == END_RESP)
+    {
+        error(trans, "Phase " + std::string(phase.get_name()) + " sent on backward path", "15.2.3 c)");
+    }
+}
+
+void TlmProtocolChecker::checkTiming(const tlm_generic_payload& trans, Entry& entry, const sc_time& delay,
+                                     const char* direction)
+{
+    sc_time time = sc_time_stamp() + delay;
+    if (time < entry.time)
+        error(trans, std::string(direction) + " called with decreasing timing annotation", "15.2.7 c)");
+    entry.time = time;
+}
+
+void TlmProtocolChecker::completeTransaction(const tlm_generic_payload& trans)
+{
+    if (requestInProgress == &trans)
+        requestInProgress = nullptr;
+    if (responseInProgress == &trans)
+        responseInProgress = nullptr;
+    sampledTransactions.erase(&trans);
+}
+
+void TlmProtocolChecker::error(const tlm_generic_payload& trans, const std::string& message, const char* rule) const
+{
+    std::ostringstream text;
+    text << message << "\n\nRefer to IEEE Std 1666-2011, clause " << rule
+         << "\n\nChecker instance: " << name()
+         << "\n\nTransaction details:"
+         << "\n  address            = " << std::hex << trans.get_address() << " (hex)"
+         << "\n  data_length        = " << std::dec << trans.get_data_length()
+         << "\n  command            = " << (trans.is_read() ? "TLM_READ_COMMAND" : "TLM_WRITE_COMMAND")
+         << "\n  ref_count          = " << trans.get_ref_count() << "\n";
+    SC_REPORT_ERROR("tlm2_protocol_checker", text.str().c_str());
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef TLMPROTOCOLCHECKER_H
+#define TLMPROTOCOLCHECKER_H
+
+#include "DRAMSys/common/PayloadTable.h"
+
+#include <cstdint>
+#include <string>
+#include <systemc>
+#include <tlm>
+
+namespace DRAMSys
+{
+
+// Lightweight alternative to tlm_utils::tlm2_base_protocol_checker that is inlined between the
+// arbiter and a controller. It only checks the four phases of the base protocol used by DRAMSys.
+// The exclusion rules are checked for every transaction, the phase sequence and the timing
+// annotation only for every samplingRate-th transaction. The state of the sampled transactions
+// is kept in a PayloadTable.
+class TlmProtocolChecker : public sc_core::sc_module,
+                           public tlm::tlm_fw_transport_if<tlm::tlm_base_protocol_types>,
+                           public tlm::tlm_bw_transport_if<tlm::tlm_base_protocol_types>
+{
+public:
+    tlm::tlm_target_socket<32, tlm::tlm_base_protocol_types, 1> target_socket;
+    tlm::tlm_initiator_socket<32, tlm::tlm_base_protocol_types, 1> initiator_socket;
+
+    TlmProtocolChecker(const sc_core::sc_module_name& name, unsigned samplingRate);
+
+    tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans, tlm::tlm_phase& phase,
+                                       sc_core::sc_time& delay) override;
+    tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload& trans, tlm::tlm_phase& phase,
+                                       sc_core::sc_time& delay) override;
+    void b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) override;
+    bool get_direct_mem_ptr(tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmiData) override;
+    void invalidate_direct_mem_ptr(sc_dt::uint64 startRange, sc_dt::uint64 endRange) override;
+    unsigned int transport_dbg(tlm::tlm_generic_payload& trans) override;
+
+private:
+    enum class Phase : uint8_t {BeginReq, EndReq, BeginResp};
+
+    struct Entry
+    {
+        Phase phase = Phase::BeginReq;
+        sc_core::sc_time time;
+    };
+
+    void checkForward(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase,
+                      const sc_core::sc_time& delay);
+    void checkBackward(tlm::tlm_generic_payload& trans, const tlm::tlm_phase& phase,
+                       const sc_core::sc_time& delay);
+    void checkTiming(const tlm::tlm_generic_payload& trans, Entry& entry, const sc_core::sc_time& delay,
+                     const char* direction);
+    void completeTransaction(const tlm::tlm_generic_payload& trans);
+    void error(const tlm::tlm_generic_payload& trans, const std::string& message, const char* rule) const;
+
+    const unsigned samplingRate;
+    uint64_t requestCounter = 0;
+
+    PayloadTable<Entry> sampledTransactions;
+
+    const tlm::tlm_generic_payload* requestInProgress = nullptr;
+    const tlm::tlm_generic_payload* responseInProgress = nullptr;
+};
+
+} // namespace DRAMSys
+
+#endif // TLMPROTOCOLCHECKER_H
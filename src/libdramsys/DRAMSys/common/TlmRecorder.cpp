@@ -43,6 +43,7 @@
 
 #include "DRAMSys/common/DebugManager.h"
 
+#include <array>
 #include <fstream>
 #include <sqlite3.h>
 
@@ -72,6 +73,8 @@ TlmRecorder::TlmRecorder(const std::string& name, const Configuration& config, c
 
     executeInitialSqlCommand();
     prepareSqlStatements();
+    if (config.databaseSchemaVersion == 2)
+        insertPhaseNames();
 
     PRINTDEBUGMESSAGE(name, "Starting new database transaction");
 }
@@ -91,6 +94,8 @@ void TlmRecorder::finalize()
     sqlite3_finalize(insertPowerStatement);
     sqlite3_finalize(insertBufferDepthStatement);
     sqlite3_finalize(insertBandwidthStatement);
+    sqlite3_finalize(insertDataStrobeStatement);
+    sqlite3_finalize(insertPhaseNameStatement);
 }
 
 void TlmRecorder::recordPower(double timeInSeconds, double averagePower)
@@ -297,9 +302,17 @@ void TlmRecorder::commitRecordedDataToDB()
     {
         assert(!transaction.recordedPhases.empty());
         insertTransactionInDB(transaction);
-        for (const Transaction::Phase& phase : transaction.recordedPhases)
+        if (config.databaseSchemaVersion == 2)
         {
-            insertPhaseInDB(phase, transaction.id);
+            for (unsigned phaseNumber = 0; phaseNumber < transaction.recordedPhases.size(); phaseNumber++)
+                insertPhaseInDBV2(transaction.recordedPhases[phaseNumber], transaction.id, phaseNumber);
+        }
+        else
+        {
+            for (const Transaction::Phase& phase : transaction.recordedPhases)
+            {
+                insertPhaseInDB(phase, transaction.id);
+            }
         }
 
         sc_time rangeBegin = transaction.recordedPhases.front().interval.start;
@@ -366,6 +379,22 @@ void TlmRecorder::prepareSqlStatements()
     insertBufferDepthString = "INSERT INTO BufferDepth VALUES (:time,:bufferNumber,:averageBufferDepth)";
     insertBandwidthString = "INSERT INTO Bandwidth VALUES (:time,:averageBandwidth)";
 
+    if (config.databaseSchemaVersion == 2)
+    {
+        // Parameter ?2 (range ID) is not stored, the Transactions view derives it from the transaction ID
+        insertTransactionString = "INSERT INTO TransactionsV2 VALUES (?1,?3,?4,?5,?6,?7,?8)";
+
+        insertPhaseString =
+                "INSERT INTO PhasesV2 VALUES (:transaction,:phaseNumber,:phaseID,:begin,:end,:rank,:bankGroup,:bank,"
+                ":row,:column,:burstLength)";
+
+        insertDataStrobeString = "INSERT INTO DataStrobes VALUES (:transaction,:phaseNumber,:strobeBegin,:strobeEnd)";
+        insertPhaseNameString = "INSERT INTO PhaseNames VALUES (:id,:name)";
+
+        sqlite3_prepare_v2(db, insertDataStrobeString.c_str(), -1, &insertDataStrobeStatement, nullptr);
+        sqlite3_prepare_v2(db, insertPhaseNameString.c_str(), -1, &insertPhaseNameStatement, nullptr);
+    }
+
     sqlite3_prepare_v2(db, insertTransactionString.c_str(), -1, &insertTransactionStatement, nullptr);
     sqlite3_prepare_v2(db, insertRangeString.c_str(), -1, &insertRangeStatement, nullptr);
     sqlite3_prepare_v2(db, updateRangeString.c_str(), -1, &updateRangeStatement, nullptr);
@@ -487,6 +516,69 @@ void TlmRecorder::insertPhaseInDB(const Transaction::Phase& phase, uint64_t tran
     executeSqlStatement(insertPhaseStatement);
 }
 
+void TlmRecorder::insertPhaseInDBV2(const Transaction::Phase& phase, uint64_t transactionID, unsigned phaseNumber)
+{
+    unsigned phaseID = phaseNameIDs.at(phase.name);
+    uint64_t beginCycle = toCycles(phase.interval.start);
+
+    sqlite3_bind_int64(insertPhaseStatement, 1, static_cast<int64_t>(transactionID));
+    sqlite3_bind_int(insertPhaseStatement, 2, static_cast<int>(phaseNumber));
+    sqlite3_bind_int(insertPhaseStatement, 3, static_cast<int>(phaseID));
+    sqlite3_bind_int64(insertPhaseStatement, 4, static_cast<int64_t>(beginCycle));
+    sqlite3_bind_int64(insertPhaseStatement, 5, static_cast<int64_t>(toCycles(phase.interval.end)));
+    sqlite3_bind_int(insertPhaseStatement, 6, static_cast<int>(phase.rank.ID()));
+    sqlite3_bind_int(insertPhaseStatement, 7, static_cast<int>(phase.bankGroup.ID()));
+    sqlite3_bind_int(insertPhaseStatement, 8, static_cast<int>(phase.bank.ID()));
+    sqlite3_bind_int(insertPhaseStatement, 9, static_cast<int>(phase.row.ID()));
+    sqlite3_bind_int(insertPhaseStatement, 10, static_cast<int>(phase.column.ID()));
+    sqlite3_bind_int(insertPhaseStatement, 11, static_cast<int>(phase.burstLength));
+    executeSqlStatement(insertPhaseStatement);
+
+    // Only CAS phases occupy the data strobe, all other phases are represented by a missing row
+    if (phase.intervalOnDataStrobe.end != SC_ZERO_TIME)
+    {
+        // Offsets are exact because the data strobe is not necessarily aligned to the clock
+        auto phaseBegin = static_cast<int64_t>(beginCycle * memSpec.tCK.value());
+        sqlite3_bind_int64(insertDataStrobeStatement, 1, static_cast<int64_t>(transactionID));
+        sqlite3_bind_int(insertDataStrobeStatement, 2, static_cast<int>(phaseNumber));
+        sqlite3_bind_int64(insertDataStrobeStatement, 3,
+                           static_cast<int64_t>(phase.intervalOnDataStrobe.start.value()) - phaseBegin);
+        sqlite3_bind_int64(insertDataStrobeStatement, 4,
+                           static_cast<int64_t>(phase.intervalOnDataStrobe.end.value()) - phaseBegin);
+        executeSqlStatement(insertDataStrobeStatement);
+    }
+}
+
+void TlmRecorder::insertPhaseNames()
+{
+    // All recordable phases are known up front, so the Phases view is complete even if the simulation aborts
+    const std::array<tlm_phase, 22> recordedPhases =
+            {BEGIN_REQ, BEGIN_RESP, BEGIN_NOP, BEGIN_RD, BEGIN_WR, BEGIN_RDA, BEGIN_WRA, BEGIN_ACT,
+             BEGIN_PREPB, BEGIN_REFPB, BEGIN_RFMPB, BEGIN_REFP2B, BEGIN_RFMP2B, BEGIN_PRESB, BEGIN_REFSB,
+             BEGIN_RFMSB, BEGIN_PREAB, BEGIN_REFAB, BEGIN_RFMAB, BEGIN_PDNA, BEGIN_PDNP, BEGIN_SREF};
+
+    for (const auto& phase : recordedPhases)
+    {
+        std::string phaseName = getPhaseName(phase).substr(6); // remove "BEGIN_"
+        auto phaseID = static_cast<unsigned>(phase);
+        phaseNameIDs.emplace(phaseName, phaseID);
+
+        sqlite3_bind_int(insertPhaseNameStatement, 1, static_cast<int>(phaseID));
+        sqlite3_bind_text(insertPhaseNameStatement, 2, phaseName.c_str(), static_cast<int>(phaseName.length()),
+                          nullptr);
+        executeSqlStatement(insertPhaseNameStatement);
+    }
+}
+
+uint64_t TlmRecorder::toCycles(const sc_time& time)
+{
+    uint64_t clockPeriod = memSpec.tCK.value();
+    uint64_t cycles = (time.value() + clockPeriod / 2) / clockPeriod;
+    if (cycles * clockPeriod != time.value())
+        roundedToClockCycle = true;
+    return cycles;
+}
+
 
 void TlmRecorder::executeSqlStatement(sqlite3_stmt *statement)
 {
@@ -502,8 +594,14 @@ void TlmRecorder::executeInitialSqlCommand()
 {
     PRINTDEBUGMESSAGE(name, "Creating database by running provided sql script");
 
+    std::string command = initialCommand;
+    if (config.databaseSchemaVersion == 2)
+        command += phaseTablesV2 + "PRAGMA user_version = 2;\n";
+    else
+        command += phaseTablesV1;
+
     char *errMsg = nullptr;
-    int rc = sqlite3_exec(db, initialCommand.c_str(), nullptr, nullptr, &errMsg);
+    int rc = sqlite3_exec(db, command.c_str(), nullptr, nullptr, &errMsg);
     if (rc != SQLITE_OK) {
         SC_REPORT_FATAL("SQLITE Error", errMsg);
         sqlite3_free(errMsg);
@@ -521,6 +619,9 @@ void TlmRecorder::closeConnection()
     commitRecordedDataToDB();
     insertGeneralInfo();
     insertCommandLengths();
+    if (config.databaseSchemaVersion == 2 && roundedToClockCycle)
+        SC_REPORT_WARNING("TlmRecorder", "Phase times that are not aligned to the clock were rounded to the "
+                                         "nearest cycle in the database");
     PRINTDEBUGMESSAGE(name, "Number of transactions written to DB: "
                       + std::to_string(totalNumTransactions));
     PRINTDEBUGMESSAGE(name, "tlmPhaseRecorder:\tEnd Recording");
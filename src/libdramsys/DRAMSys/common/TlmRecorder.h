@@ -88,6 +88,12 @@ public:
     void recordDebugMessage(const std::string &message, const sc_core::sc_time &time);
     void finalize();
 
+    // Transactions in flight and completed transactions that are not committed to the database yet
+    std::size_t getQueueDepth() const
+    {
+        return currentTransactionsInSystem.size() + currentDataBuffer->size();
+    }
+
 private:
     const Configuration& config;
     const MemSpec& memSpec;
@@ -152,6 +158,9 @@ private:
     void insertTransactionInDB(const Transaction& recordingData);
     void insertRangeInDB(uint64_t id, const sc_core::sc_time &begin, const sc_core::sc_time &end);
     void insertPhaseInDB(const Transaction::Phase& phase, uint64_t transactionID);
+    void insertPhaseInDBV2(const Transaction::Phase& phase, uint64_t transactionID, unsigned phaseNumber);
+    void insertPhaseNames();
+    uint64_t toCycles(const sc_core::sc_time& time);
     void insertDebugMessageInDB(const std::string &message, const sc_core::sc_time &time);
 
     static constexpr unsigned transactionCommitRate = 8192;
@@ -165,16 +174,22 @@ private:
     uint64_t totalNumTransactions;
     sc_core::sc_time simulationTimeCoveredByRecording;
 
+    // Schema version 2 only, both are accessed by the storage thread
+    std::unordered_map<std::string, unsigned> phaseNameIDs;
+    bool roundedToClockCycle = false;
+
     sqlite3 *db = nullptr;
     sqlite3_stmt *insertTransactionStatement = nullptr, *insertRangeStatement = nullptr,
             *updateRangeStatement = nullptr, *insertPhaseStatement = nullptr, *updatePhaseStatement = nullptr,
             *insertGeneralInfoStatement = nullptr, *insertCommandLengthsStatement = nullptr,
             *insertDebugMessageStatement = nullptr, *insertPowerStatement = nullptr,
-            *insertBufferDepthStatement = nullptr, *insertBandwidthStatement = nullptr;
+            *insertBufferDepthStatement = nullptr, *insertBandwidthStatement = nullptr,
+            *insertDataStrobeStatement = nullptr, *insertPhaseNameStatement = nullptr;
     std::string insertTransactionString, insertRangeString, updateRangeString, insertPhaseString,
             updatePhaseString, insertGeneralInfoString, insertCommandLengthsString,
             insertDebugMessageString, insertPowerString,
-            insertBufferDepthString, insertBandwidthString;
+            insertBufferDepthString, insertBandwidthString,
+            insertDataStrobeString, insertPhaseNameString;
 
     std::string initialCommand =
         "DROP TABLE IF EXISTS Phases;                                                                              \n"
@@ -188,22 +203,6 @@ private:
         "DROP TABLE IF EXISTS BufferDepth;                                                                         \n"
         "DROP TABLE IF EXISTS Bandwidth;                                                                           \n"
         "                                                                                                          \n"
-        "CREATE TABLE Phases(                                                                                      \n"
-        "        ID INTEGER PRIMARY KEY,                                                                           \n"
-        "        PhaseName TEXT,                                                                                   \n"
-        "        PhaseBegin INTEGER,                                                                               \n"
-        "        PhaseEnd INTEGER,                                                                                 \n"
-        "        DataStrobeBegin INTEGER,                                                                          \n"
-        "        DataStrobeEnd INTEGER,                                                                            \n"
-        "        Rank INTEGER,                                                                                     \n"
-        "        BankGroup INTEGER,                                                                                \n"
-        "        Bank INTEGER,                                                                                     \n"
-        "        Row INTEGER,                                                                                      \n"
-        "        Column INTEGER,                                                                                   \n"
-        "        BurstLength INTEGER,                                                                              \n"
-        "        Transact INTEGER                                                                                  \n"
-        ");                                                                                                        \n"
-        "                                                                                                          \n"
         "CREATE TABLE GeneralInfo(                                                                                 \n"
         "        NumberOfTransactions INTEGER,                                                                     \n"
         "        TraceEnd INTEGER,                                                                                 \n"
@@ -262,6 +261,25 @@ private:
         "   begin, end                                                                                             \n"
         ");                                                                                                        \n"
         "                                                                                                          \n"
+        "CREATE INDEX \"messageTimes\" ON \"DebugMessages\" (\"Time\" ASC);                                        \n";
+
+    std::string phaseTablesV1 =
+        "CREATE TABLE Phases(                                                                                      \n"
+        "        ID INTEGER PRIMARY KEY,                                                                           \n"
+        "        PhaseName TEXT,                                                                                   \n"
+        "        PhaseBegin INTEGER,                                                                               \n"
+        "        PhaseEnd INTEGER,                                                                                 \n"
+        "        DataStrobeBegin INTEGER,                                                                          \n"
+        "        DataStrobeEnd INTEGER,                                                                            \n"
+        "        Rank INTEGER,                                                                                     \n"
+        "        BankGroup INTEGER,                                                                                \n"
+        "        Bank INTEGER,                                                                                     \n"
+        "        Row INTEGER,                                                                                      \n"
+        "        Column INTEGER,                                                                                   \n"
+        "        BurstLength INTEGER,                                                                              \n"
+        "        Transact INTEGER                                                                                  \n"
+        ");                                                                                                        \n"
+        "                                                                                                          \n"
         "CREATE TABLE Transactions(                                                                                \n"
         "        ID INTEGER,                                                                                       \n"
         "        Range INTEGER,                                                                                    \n"
@@ -274,8 +292,65 @@ private:
         ");                                                                                                        \n"
         "                                                                                                          \n"
         "CREATE INDEX ranges_index ON Transactions(Range);                                                         \n"
-        "CREATE INDEX \"phasesTransactions\" ON \"Phases\" (\"Transact\" ASC);                                     \n"
-        "CREATE INDEX \"messageTimes\" ON \"DebugMessages\" (\"Time\" ASC);                                        \n";
+        "CREATE INDEX \"phasesTransactions\" ON \"Phases\" (\"Transact\" ASC);                                     \n";
+
+    std::string phaseTablesV2 =
+        "CREATE TABLE PhaseNames(                                                                                  \n"
+        "        ID INTEGER PRIMARY KEY,                                                                           \n"
+        "        Name TEXT                                                                                         \n"
+        ");                                                                                                        \n"
+        "                                                                                                          \n"
+        "-- times in clock cycles, data strobe intervals of CAS phases are stored separately                       \n"
+        "CREATE TABLE PhasesV2(                                                                                    \n"
+        "        Transact INTEGER,                                                                                 \n"
+        "        PhaseNumber INTEGER,                                                                              \n"
+        "        PhaseID INTEGER,                                                                                  \n"
+        "        BeginCycle INTEGER,                                                                               \n"
+        "        EndCycle INTEGER,                                                                                 \n"
+        "        Rank INTEGER,                                                                                     \n"
+        "        BankGroup INTEGER,                                                                                \n"
+        "        Bank INTEGER,                                                                                     \n"
+        "        Row INTEGER,                                                                                      \n"
+        "        Column INTEGER,                                                                                   \n"
+        "        BurstLength INTEGER,                                                                              \n"
+        "        PRIMARY KEY (Transact, PhaseNumber)                                                               \n"
+        ") WITHOUT ROWID;                                                                                          \n"
+        "                                                                                                          \n"
+        "-- offsets in units of time relative to the first cycle of the phase                                      \n"
+        "CREATE TABLE DataStrobes(                                                                                 \n"
+        "        Transact INTEGER,                                                                                 \n"
+        "        PhaseNumber INTEGER,                                                                              \n"
+        "        BeginOffset INTEGER,                                                                              \n"
+        "        EndOffset INTEGER,                                                                                \n"
+        "        PRIMARY KEY (Transact, PhaseNumber)                                                               \n"
+        ") WITHOUT ROWID;                                                                                          \n"
+        "                                                                                                          \n"
+        "CREATE TABLE TransactionsV2(                                                                              \n"
+        "        ID INTEGER PRIMARY KEY,                                                                           \n"
+        "        Address INTEGER,                                                                                  \n"
+        "        DataLength INTEGER,                                                                               \n"
+        "        Thread INTEGER,                                                                                   \n"
+        "        Channel INTEGER,                                                                                  \n"
+        "        TimeOfGeneration INTEGER,                                                                         \n"
+        "        Command TEXT                                                                                      \n"
+        ");                                                                                                        \n"
+        "                                                                                                          \n"
+        "-- compatibility views with the layout of schema version 1, phase IDs are (Transact << 16) | PhaseNumber  \n"
+        "CREATE VIEW Phases AS SELECT                                                                              \n"
+        "        (p.Transact << 16) | p.PhaseNumber AS ID,                                                         \n"
+        "        n.Name AS PhaseName,                                                                              \n"
+        "        p.BeginCycle * (SELECT clk FROM GeneralInfo) AS PhaseBegin,                                       \n"
+        "        p.EndCycle * (SELECT clk FROM GeneralInfo) AS PhaseEnd,                                           \n"
+        "        COALESCE(p.BeginCycle * (SELECT clk FROM GeneralInfo) + s.BeginOffset, 0) AS DataStrobeBegin,     \n"
+        "        COALESCE(p.BeginCycle * (SELECT clk FROM GeneralInfo) + s.EndOffset, 0) AS DataStrobeEnd,         \n"
+        "        p.Rank, p.BankGroup, p.Bank, p.Row, p.Column, p.BurstLength, p.Transact                           \n"
+        "    FROM PhasesV2 p                                                                                       \n"
+        "    JOIN PhaseNames n ON n.ID = p.PhaseID                                                                 \n"
+        "    LEFT JOIN DataStrobes s ON s.Transact = p.Transact AND s.PhaseNumber = p.PhaseNumber;                 \n"
+        "                                                                                                          \n"
+        "CREATE VIEW Transactions AS SELECT                                                                        \n"
+        "        ID, ID AS Range, Address, DataLength, Thread, Channel, TimeOfGeneration, Command                  \n"
+        "    FROM TransactionsV2;                                                                                  \n";
 };
 
 } // namespace DRAMSys
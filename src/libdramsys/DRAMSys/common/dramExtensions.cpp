@@ -272,6 +272,66 @@ unsigned ControllerExtension::getBurstLength(const tlm::tlm_generic_payload& tra
     return trans.get_extension<ControllerExtension>()->burstLength;
 }
 
+DeadlineExtension::DeadlineExtension(const sc_time& deadline) : deadline(deadline)
+{}
+
+void DeadlineExtension::setAutoExtension(tlm_generic_payload& trans, const sc_time& deadline)
+{
+    auto* extension = trans.get_extension<DeadlineExtension>();
+
+    if (extension != nullptr)
+        extension->deadline = deadline;
+    else
+        trans.set_auto_extension(new DeadlineExtension(deadline));
+}
+
+tlm_extension_base* DeadlineExtension::clone() const
+{
+    return new DeadlineExtension(deadline);
+}
+
+void DeadlineExtension::copy_from(const tlm_extension_base& ext)
+{
+    const auto& cpyFrom = dynamic_cast<const DeadlineExtension&>(ext);
+    deadline = cpyFrom.deadline;
+}
+
+sc_time DeadlineExtension::getDeadline(const tlm_generic_payload& trans)
+{
+    const auto* extension = trans.get_extension<DeadlineExtension>();
+    return extension != nullptr ? extension->deadline : sc_max_time();
+}
+
+RefreshModeExtension::RefreshModeExtension(Mode mode) : mode(mode)
+{}
+
+void RefreshModeExtension::setAutoExtension(tlm_generic_payload& trans, Mode mode)
+{
+    auto* extension = trans.get_extension<RefreshModeExtension>();
+
+    if (extension != nullptr)
+        extension->mode = mode;
+    else
+        trans.set_auto_extension(new RefreshModeExtension(mode));
+}
+
+tlm_extension_base* RefreshModeExtension::clone() const
+{
+    return new RefreshModeExtension(mode);
+}
+
+void RefreshModeExtension::copy_from(const tlm_extension_base& ext)
+{
+    const auto& cpyFrom = dynamic_cast<const RefreshModeExtension&>(ext);
+    mode = cpyFrom.mode;
+}
+
+RefreshModeExtension::Mode RefreshModeExtension::getMode(const tlm_generic_payload& trans)
+{
+    const auto* extension = trans.get_extension<RefreshModeExtension>();
+    return extension != nullptr ? extension->mode : Mode::Fine;
+}
+
 //THREAD
 bool operator ==(const Thread &lhs, const Thread &rhs)
 {
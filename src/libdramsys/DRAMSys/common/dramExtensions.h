@@ -231,6 +231,47 @@ private:
     unsigned burstLength;
 };
 
+// Absolute deadline of a real-time request, attached by the initiator. Requests without the
+// extension are best effort.
+class DeadlineExtension : public tlm::tlm_extension<DeadlineExtension>
+{
+public:
+    static void setAutoExtension(tlm::tlm_generic_payload& trans, const sc_core::sc_time& deadline);
+
+    tlm::tlm_extension_base* clone() const override;
+    void copy_from(const tlm::tlm_extension_base& ext) override;
+
+    // Returns sc_max_time() for requests without a deadline
+    static sc_core::sc_time getDeadline(const tlm::tlm_generic_payload& trans);
+
+private:
+    explicit DeadlineExtension(const sc_core::sc_time& deadline);
+    sc_core::sc_time deadline;
+};
+
+// Refresh mode of an all-bank refresh for DDR4 on-the-fly fine granularity refresh
+class RefreshModeExtension : public tlm::tlm_extension<RefreshModeExtension>
+{
+public:
+    enum class Mode
+    {
+        Fine,  // granularity set by the memspec entry REFM
+        Normal // 1x refresh
+    };
+
+    static void setAutoExtension(tlm::tlm_generic_payload& trans, Mode mode);
+
+    tlm::tlm_extension_base* clone() const override;
+    void copy_from(const tlm::tlm_extension_base& ext) override;
+
+    // Returns Mode::Fine for refreshes without a mode
+    static Mode getMode(const tlm::tlm_generic_payload& trans);
+
+private:
+    explicit RefreshModeExtension(Mode mode);
+    Mode mode;
+};
+
 
 bool operator==(const Thread &lhs, const Thread &rhs);
 bool operator!=(const Thread &lhs, const Thread &rhs);
@@ -92,9 +92,15 @@ void Configuration::loadSimConfig(const DRAMSys::Config::SimConfig &simConfig)
 {   
     addressOffset = simConfig.AddressOffset.value_or(addressOffset);
     checkTLM2Protocol = simConfig.CheckTLM2Protocol.value_or(checkTLM2Protocol);
+    checkTLM2ProtocolSampling = simConfig.CheckTLM2ProtocolSampling.value_or(checkTLM2ProtocolSampling);
+    commandFingerprintInterval = simConfig.CommandFingerprintInterval.value_or(commandFingerprintInterval);
     databaseRecording = simConfig.DatabaseRecording.value_or(databaseRecording);
+    databaseSchemaVersion = simConfig.DatabaseSchemaVersion.value_or(databaseSchemaVersion);
+    if (databaseSchemaVersion != 1 && databaseSchemaVersion != 2)
+        SC_REPORT_FATAL("Configuration", "Invalid DatabaseSchemaVersion");
     debug = simConfig.Debug.value_or(debug);
     enableWindowing = simConfig.EnableWindowing.value_or(enableWindowing);
+    eventLogSize = simConfig.EventLogSize.value_or(eventLogSize);
     simulationName = simConfig.SimulationName.value_or(simulationName);
     simulationProgressBar = simConfig.SimulationProgressBar.value_or(simulationProgressBar);
     useMalloc = simConfig.UseMalloc.value_or(useMalloc);
@@ -114,6 +120,12 @@ void Configuration::loadSimConfig(const DRAMSys::Config::SimConfig &simConfig)
             }
         }();
 
+    dataBusStatistics = simConfig.DataBusStatistics.value_or(dataBusStatistics);
+    dataBusToggleEnergy = simConfig.DataBusToggleEnergy.value_or(dataBusToggleEnergy);
+    dataBusZeroEnergy = simConfig.DataBusZeroEnergy.value_or(dataBusZeroEnergy);
+    if (dataBusStatistics && storeMode != StoreMode::Store)
+        SC_REPORT_FATAL("Configuration", "Data bus statistics require StoreMode Store!");
+
     windowSize = simConfig.WindowSize.value_or(windowSize);
     if (windowSize == 0)
             SC_REPORT_FATAL("Configuration", "Minimum window size is 1");
@@ -161,6 +173,10 @@ void Configuration::loadMCConfig(const DRAMSys::Config::McConfig &mcConfig)
                 return Scheduler::GrpFrFcfs;
             case DRAMSys::Config::SchedulerType::GrpFrFcfsWm:
                 return Scheduler::GrpFrFcfsWm;
+            case DRAMSys::Config::SchedulerType::Edf:
+                return Scheduler::Edf;
+            case DRAMSys::Config::SchedulerType::ReadPriority:
+                return Scheduler::ReadPriority;
             default:
                 SC_REPORT_FATAL("Configuration", "Invalid Scheduler");
                 return Scheduler::Fifo; // Silence Warning
@@ -193,6 +209,8 @@ void Configuration::loadMCConfig(const DRAMSys::Config::McConfig &mcConfig)
                 return CmdMux::Oldest;
             case DRAMSys::Config::CmdMuxType::Strict:
                 return CmdMux::Strict;
+            case DRAMSys::Config::CmdMuxType::BankGroup:
+                return CmdMux::BankGroup;
             default:
                 SC_REPORT_FATAL("Configuration", "Invalid CmdMux");
                 return CmdMux::Oldest; // Silence Warning
@@ -229,6 +247,8 @@ void Configuration::loadMCConfig(const DRAMSys::Config::McConfig &mcConfig)
                 return RefreshPolicy::Per2Bank;
             case DRAMSys::Config::RefreshPolicyType::SameBank:
                 return RefreshPolicy::SameBank;
+            case DRAMSys::Config::RefreshPolicyType::Retention:
+                return RefreshPolicy::Retention;
             default:
                 SC_REPORT_FATAL("Configuration", "Invalid RefreshPolicy");
                 return RefreshPolicy::NoRefresh; // Silence Warning
@@ -269,15 +289,53 @@ void Configuration::loadMCConfig(const DRAMSys::Config::McConfig &mcConfig)
 
     refreshMaxPostponed = mcConfig.RefreshMaxPostponed.value_or(refreshMaxPostponed);
     refreshMaxPulledin = mcConfig.RefreshMaxPulledin.value_or(refreshMaxPulledin);
+    retentionProfile = mcConfig.RetentionProfile.value_or(retentionProfile);
+    retentionSeed = mcConfig.RetentionSeed.value_or(retentionSeed);
+    if (const auto& _retentionRefreshWindow = mcConfig.RetentionRefreshWindow)
+        retentionRefreshWindow = sc_time(*_retentionRefreshWindow, SC_MS);
     highWatermark = mcConfig.HighWatermark.value_or(highWatermark);
     lowWatermark = mcConfig.LowWatermark.value_or(lowWatermark);
+
+    if (const auto& _deadlineSlack = mcConfig.DeadlineSlack)
+    {
+         deadlineSlack = std::round(sc_time(*_deadlineSlack, SC_NS) / memSpec->tCK) * memSpec->tCK;
+    }
+
+    writeBatchSize = mcConfig.WriteBatchSize.value_or(writeBatchSize);
+    if (writeBatchSize == 0)
+        SC_REPORT_FATAL("Configuration", "Minimum write batch size is 1!");
+
+    writeCancellation = mcConfig.WriteCancellation.value_or(writeCancellation);
+    if (writeCancellation && memSpec->memoryType != MemSpec::MemoryType::STTMRAM)
+        SC_REPORT_FATAL("Configuration", "Write cancellation is only supported for STT-MRAM!");
+
+    if (const auto& _writeRestartPenalty = mcConfig.WriteRestartPenalty)
+    {
+         writeRestartPenalty = std::round(sc_time(*_writeRestartPenalty, SC_NS) / memSpec->tCK) * memSpec->tCK;
+    }
+
     maxActiveTransactions = mcConfig.MaxActiveTransactions.value_or(maxActiveTransactions);
+    bankGroupStarvationLimit = mcConfig.BankGroupStarvationLimit.value_or(bankGroupStarvationLimit);
     refreshManagement = mcConfig.RefreshManagement.value_or(refreshManagement);
+    subarrayLevelParallelism = mcConfig.SubarrayLevelParallelism.value_or(subarrayLevelParallelism);
 
     requestBufferSize = mcConfig.RequestBufferSize.value_or(requestBufferSize);
     if (requestBufferSize == 0)
         SC_REPORT_FATAL("Configuration", "Minimum request buffer size is 1!");
 
+    ingressQueueSize = mcConfig.IngressQueueSize.value_or(ingressQueueSize);
+
+    if (const auto& _powerDownBatchDelay = mcConfig.PowerDownBatchDelay)
+    {
+         powerDownBatchDelay = std::round(sc_time(*_powerDownBatchDelay, SC_NS) / memSpec->tCK) * memSpec->tCK;
+    }
+
+    powerDownBatchSize = mcConfig.PowerDownBatchSize.value_or(powerDownBatchSize);
+    if (powerDownBatchSize == 0)
+        SC_REPORT_FATAL("Configuration", "Minimum power-down batch size is 1!");
+
+    powerDownBatchDepth = mcConfig.PowerDownBatchDepth.value_or(powerDownBatchDepth);
+
     if (const auto& _arbitrationDelayFw = mcConfig.ArbitrationDelayFw)
     {
          arbitrationDelayFw = std::round(sc_time(*_arbitrationDelayFw, SC_NS) / memSpec->tCK) * memSpec->tCK;
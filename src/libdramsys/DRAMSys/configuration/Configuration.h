@@ -62,20 +62,33 @@ public:
 public:
     // MCConfig:
     enum class PagePolicy {Open, Closed, OpenAdaptive, ClosedAdaptive} pagePolicy = PagePolicy::Open;
-    enum class Scheduler {Fifo, FrFcfs, FrFcfsGrp, GrpFrFcfs, GrpFrFcfsWm} scheduler = Scheduler::FrFcfs;
+    enum class Scheduler {Fifo, FrFcfs, FrFcfsGrp, GrpFrFcfs, GrpFrFcfsWm, Edf, ReadPriority} scheduler = Scheduler::FrFcfs;
     enum class SchedulerBuffer {Bankwise, ReadWrite, Shared} schedulerBuffer = SchedulerBuffer::Bankwise;
     unsigned int lowWatermark = 0;
     unsigned int highWatermark = 0;
-    enum class CmdMux {Oldest, Strict} cmdMux = CmdMux::Oldest;
+    sc_core::sc_time deadlineSlack = sc_core::sc_time(100, sc_core::SC_NS);
+    unsigned int writeBatchSize = 4;
+    bool writeCancellation = false;
+    sc_core::sc_time writeRestartPenalty = sc_core::SC_ZERO_TIME;
+    enum class CmdMux {Oldest, Strict, BankGroup} cmdMux = CmdMux::Oldest;
+    unsigned int bankGroupStarvationLimit = 4;
     enum class RespQueue {Fifo, Reorder} respQueue = RespQueue::Fifo;
     enum class Arbiter {Simple, Fifo, Reorder} arbiter = Arbiter::Simple;
     unsigned int requestBufferSize = 8;
-    enum class RefreshPolicy {NoRefresh, PerBank, Per2Bank, SameBank, AllBank} refreshPolicy = RefreshPolicy::AllBank;
+    unsigned int ingressQueueSize = 0;
+    enum class RefreshPolicy {NoRefresh, PerBank, Per2Bank, SameBank, AllBank, Retention} refreshPolicy = RefreshPolicy::AllBank;
     unsigned int refreshMaxPostponed = 0;
     unsigned int refreshMaxPulledin = 0;
+    std::string retentionProfile;
+    uint64_t retentionSeed = 0;
+    sc_core::sc_time retentionRefreshWindow = sc_core::sc_time(64, sc_core::SC_MS);
     enum class PowerDownPolicy {NoPowerDown, Staggered} powerDownPolicy = PowerDownPolicy::NoPowerDown;
+    sc_core::sc_time powerDownBatchDelay = sc_core::SC_ZERO_TIME;
+    unsigned int powerDownBatchSize = 4;
+    unsigned int powerDownBatchDepth = 8;
     unsigned int maxActiveTransactions = 64;
     bool refreshManagement = false;
+    bool subarrayLevelParallelism = false;
     sc_core::sc_time arbitrationDelayFw = sc_core::SC_ZERO_TIME;
     sc_core::sc_time arbitrationDelayBw = sc_core::SC_ZERO_TIME;
     sc_core::sc_time thinkDelayFw = sc_core::SC_ZERO_TIME;
@@ -88,16 +101,23 @@ public:
     // SimConfig
     std::string simulationName = "default";
     bool databaseRecording = false;
+    unsigned int databaseSchemaVersion = 1;
     bool powerAnalysis = false;
     bool enableWindowing = false;
     unsigned int windowSize = 1000;
     bool debug = false;
     bool simulationProgressBar = false;
     bool checkTLM2Protocol = false;
+    unsigned int checkTLM2ProtocolSampling = 0;
     bool useMalloc = false;
     unsigned long long int addressOffset = 0;
+    unsigned int eventLogSize = 0;
+    unsigned int commandFingerprintInterval = 0;
 
     enum class StoreMode {NoStorage, Store} storeMode = StoreMode::NoStorage;
+    bool dataBusStatistics = false;
+    double dataBusToggleEnergy = 1.0;
+    double dataBusZeroEnergy = 0.0;
 
     // MemSpec (from DRAM-Power)
     std::unique_ptr<const MemSpec> memSpec;
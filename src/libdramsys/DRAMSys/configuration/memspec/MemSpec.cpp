@@ -59,6 +59,10 @@ MemSpec::MemSpec(const DRAMSys::Config::MemSpec& memSpec,
     bankGroupsPerChannel(bankGroupsPerChannel),
     devicesPerRank(devicesPerRank),
     rowsPerBank(memSpec.memarchitecturespec.entries.at("nbrOfRows")),
+    subarraysPerBank(memSpec.memarchitecturespec.entries.find("nbrOfSubarrays") !=
+        memSpec.memarchitecturespec.entries.end()
+        ? memSpec.memarchitecturespec.entries.at("nbrOfSubarrays")
+        : 1),
     columnsPerRow(memSpec.memarchitecturespec.entries.at("nbrOfColumns")),
     defaultBurstLength(memSpec.memarchitecturespec.entries.at("burstLength")),
     maxBurstLength(memSpec.memarchitecturespec.entries.find("maxBurstLength") !=
@@ -79,6 +83,9 @@ MemSpec::MemSpec(const DRAMSys::Config::MemSpec& memSpec,
     memorySizeBytes(0)
 {
     commandLengthInCycles = std::vector<double>(Command::numberOfCommands(), 1);
+
+    if (subarraysPerBank == 0 || rowsPerBank % subarraysPerBank != 0)
+        SC_REPORT_FATAL("MemSpec", "Number of rows must be a multiple of the number of subarrays!");
 }
 
 sc_time MemSpec::getCommandLength(Command command) const
@@ -96,6 +103,11 @@ uint64_t MemSpec::getSimMemSizeInBytes() const
     return memorySizeBytes;
 }
 
+unsigned MemSpec::getSubarray(Row row) const
+{
+    return row.ID() / (rowsPerBank / subarraysPerBank);
+}
+
 sc_time MemSpec::getRefreshIntervalAB() const
 {
     SC_REPORT_FATAL("MemSpec", "All-bank refresh not supported");
@@ -131,6 +143,16 @@ unsigned MemSpec::getRAADEC() const
     return 0;
 }
 
+unsigned MemSpec::getRefreshGranularity() const
+{
+    return 1;
+}
+
+bool MemSpec::hasOnTheFlyRefresh() const
+{
+    return false;
+}
+
 unsigned MemSpec::getRAAIMT() const
 {
     SC_REPORT_FATAL("MemSpec", "Refresh Management not supported");
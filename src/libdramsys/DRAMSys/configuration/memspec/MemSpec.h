@@ -64,6 +64,7 @@ public:
     const unsigned bankGroupsPerChannel;
     const unsigned devicesPerRank;
     const unsigned rowsPerBank;
+    const unsigned subarraysPerBank;
     const unsigned columnsPerRow;
     const unsigned defaultBurstLength;
     const unsigned maxBurstLength;
@@ -93,6 +94,10 @@ public:
 
     virtual unsigned getPer2BankOffset() const;
 
+    // Fine granularity refresh: number of 1x refresh intervals covered by getRefreshIntervalAB()
+    virtual unsigned getRefreshGranularity() const;
+    virtual bool hasOnTheFlyRefresh() const;
+
     virtual unsigned getRAAIMT() const;
     virtual unsigned getRAAMMT() const;
     virtual unsigned getRAADEC() const;
@@ -105,6 +110,7 @@ public:
     sc_core::sc_time getCommandLength(Command) const;
     double getCommandLengthInCycles(Command) const;
     uint64_t getSimMemSizeInBytes() const;
+    unsigned getSubarray(Row row) const;
 
 protected:
     MemSpec(const DRAMSys::Config::MemSpec& memSpec,
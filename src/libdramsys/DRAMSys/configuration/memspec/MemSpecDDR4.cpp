@@ -37,6 +37,7 @@
 #include "MemSpecDDR4.h"
 
 #include "DRAMSys/common/utils.h"
+#include "DRAMSys/common/dramExtensions.h"
 
 #include <iostream>
 
@@ -74,16 +75,21 @@ MemSpecDDR4::MemSpecDDR4(const DRAMSys::Config::MemSpec &memSpec)
       tWR      (tCK * memSpec.memtimingspec.entries.at("WR")),
       tXP      (tCK * memSpec.memtimingspec.entries.at("XP")),
       tXS      (tCK * memSpec.memtimingspec.entries.at("XS")),
-      tREFI    ((memSpec.memtimingspec.entries.at("REFM") == 4) ?
+      refreshMode (memSpec.memtimingspec.entries.at("REFM")),
+      refreshOnTheFly (memSpec.memtimingspec.entries.find("REFOTF") != memSpec.memtimingspec.entries.end()
+                       && memSpec.memtimingspec.entries.at("REFOTF") != 0),
+      tREFI    ((refreshMode == 4) ?
                    (tCK * (static_cast<double>(memSpec.memtimingspec.entries.at("REFI")) / 4)) :
-                   ((memSpec.memtimingspec.entries.at("REFM") == 2) ?
+                   ((refreshMode == 2) ?
                    (tCK * (static_cast<double>(memSpec.memtimingspec.entries.at("REFI")) / 2)) :
                    (tCK * memSpec.memtimingspec.entries.at("REFI")))),
-      tRFC     ((memSpec.memtimingspec.entries.at("REFM") == 4) ?
+      tRFC     ((refreshMode == 4) ?
                    (tCK * memSpec.memtimingspec.entries.at("RFC4")) :
-                   ((memSpec.memtimingspec.entries.at("REFM") == 2) ?
+                   ((refreshMode == 2) ?
                    (tCK * memSpec.memtimingspec.entries.at("RFC2")) :
                    (tCK * memSpec.memtimingspec.entries.at("RFC")))),
+      tREFI1   (tCK * memSpec.memtimingspec.entries.at("REFI")),
+      tRFC1    (tCK * memSpec.memtimingspec.entries.at("RFC")),
       tRP      (tCK * memSpec.memtimingspec.entries.at("RP")),
       tDQSCK   (tCK * memSpec.memtimingspec.entries.at("DQSCK")),
       tCCD_S   (tCK * memSpec.memtimingspec.entries.at("CCD_S")),
@@ -120,6 +126,12 @@ MemSpecDDR4::MemSpecDDR4(const DRAMSys::Config::MemSpec &memSpec)
     uint64_t deviceSizeBytes = deviceSizeBits / 8;
     memorySizeBytes = deviceSizeBytes * devicesPerRank * ranksPerChannel * numberOfChannels;
 
+    if (refreshMode != 1 && refreshMode != 2 && refreshMode != 4)
+        SC_REPORT_FATAL("MemSpec", "Refresh mode REFM must be 1, 2 or 4!");
+
+    if (refreshOnTheFly && refreshMode == 1)
+        SC_REPORT_FATAL("MemSpec", "On-the-fly refresh (REFOTF) requires REFM 2 or 4!");
+
     if (!memSpec.mempowerspec.has_value())
         SC_REPORT_WARNING("MemSpec", "No power spec defined!");
 
@@ -137,6 +149,8 @@ MemSpecDDR4::MemSpecDDR4(const DRAMSys::Config::MemSpec &memSpec)
     std::cout << " Device size in bits:   " << deviceSizeBits   << std::endl;
     std::cout << " Device size in bytes:  " << deviceSizeBytes  << std::endl;
     std::cout << " Devices per rank:      " << devicesPerRank << std::endl;
+    std::cout << " Refresh mode:          " << refreshMode << "x" << (refreshOnTheFly ? " (on-the-fly)" : "")
+              << std::endl;
     std::cout << std::endl;
 }
 
@@ -145,8 +159,18 @@ sc_time MemSpecDDR4::getRefreshIntervalAB() const
     return tREFI;
 }
 
+unsigned MemSpecDDR4::getRefreshGranularity() const
+{
+    return refreshMode;
+}
+
+bool MemSpecDDR4::hasOnTheFlyRefresh() const
+{
+    return refreshOnTheFly;
+}
+
 // Returns the execution time for commands that have a fixed execution time
-sc_time MemSpecDDR4::getExecutionTime(Command command, const tlm_generic_payload &) const
+sc_time MemSpecDDR4::getExecutionTime(Command command, const tlm_generic_payload &payload) const
 {
     if (command == Command::PREPB || command == Command::PREAB)
         return tRP;
@@ -161,7 +185,8 @@ sc_time MemSpecDDR4::getExecutionTime(Command command, const tlm_generic_payload
     else if (command == Command::WRA)
         return tWL + burstDuration + tWR + tRP;
     else if (command == Command::REFAB)
-        return tRFC;
+        return (refreshOnTheFly
+                && RefreshModeExtension::getMode(payload) == RefreshModeExtension::Mode::Normal) ? tRFC1 : tRFC;
     else
     {
         SC_REPORT_FATAL("getExecutionTime",
@@ -64,8 +64,12 @@ public:
     const sc_core::sc_time tWR;
     const sc_core::sc_time tXP;
     const sc_core::sc_time tXS;
+    const unsigned refreshMode;
+    const bool refreshOnTheFly;
     const sc_core::sc_time tREFI;
     const sc_core::sc_time tRFC;
+    const sc_core::sc_time tREFI1;
+    const sc_core::sc_time tRFC1;
     const sc_core::sc_time tRP;
     const sc_core::sc_time tDQSCK;
     const sc_core::sc_time tCCD_S;
@@ -101,6 +105,8 @@ public:
     const double vDD2;
 
     sc_core::sc_time getRefreshIntervalAB() const override;
+    unsigned getRefreshGranularity() const override;
+    bool hasOnTheFlyRefresh() const override;
 
     sc_core::sc_time getExecutionTime(Command command, const tlm::tlm_generic_payload &payload) const override;
     TimeInterval getIntervalOnDataStrobe(Command command, const tlm::tlm_generic_payload &payload) const override;
@@ -47,7 +47,8 @@ namespace DRAMSys
 BankMachine::BankMachine(const Configuration& config, const SchedulerIF& scheduler, Bank bank)
     : scheduler(scheduler), memSpec(*config.memSpec), bank(bank),
     bankgroup(BankGroup(bank.ID() / memSpec.banksPerGroup)), rank(Rank(bank.ID() / memSpec.banksPerRank)),
-    refreshManagement(config.refreshManagement)
+    refreshManagement(config.refreshManagement), subarrayLevelParallelism(config.subarrayLevelParallelism),
+    openRowInSubarray(config.subarrayLevelParallelism ? memSpec.subarraysPerBank : 0, Row::NO_ROW)
 {}
 
 CommandTuple::Type BankMachine::getNextCommand()
@@ -62,11 +63,28 @@ void BankMachine::update(Command command)
     case Command::ACT:
         state = State::Activated;
         openRow = ControllerExtension::getRow(*currentPayload);
+        if (subarrayLevelParallelism)
+        {
+            openRowInSubarray[memSpec.getSubarray(openRow)] = openRow;
+            activatedSubarrays++;
+        }
         keepTrans = true;
         refreshManagementCounter++;
         break;
-    case Command::PREPB: case Command::PRESB: case Command::PREAB:
+    case Command::PREPB:
+        if (subarrayLevelParallelism && currentPayload != nullptr)
+            closeSubarray(ControllerExtension::getRow(*currentPayload));
+        else
+            state = State::Precharged;
+        keepTrans = false;
+        break;
+    case Command::PRESB: case Command::PREAB:
         state = State::Precharged;
+        if (subarrayLevelParallelism)
+        {
+            std::fill(openRowInSubarray.begin(), openRowInSubarray.end(), Row::NO_ROW);
+            activatedSubarrays = 0;
+        }
         keepTrans = false;
         break;
     case Command::RD: case Command::WR:
@@ -74,7 +92,10 @@ void BankMachine::update(Command command)
         keepTrans = false;
         break;
     case Command::RDA: case Command::WRA:
-        state = State::Precharged;
+        if (subarrayLevelParallelism)
+            closeSubarray(ControllerExtension::getRow(*currentPayload));
+        else
+            state = State::Precharged;
         currentPayload = nullptr;
         keepTrans = false;
         break;
@@ -147,6 +168,43 @@ Row BankMachine::getOpenRow() const
     return openRow;
 }
 
+bool BankMachine::isRowOpen(Row row) const
+{
+    if (subarrayLevelParallelism)
+        return openRowInSubarray[memSpec.getSubarray(row)] == row;
+
+    return state == State::Activated && openRow == row;
+}
+
+bool BankMachine::isTargetActivated() const
+{
+    if (subarrayLevelParallelism)
+        return openRowInSubarray[memSpec.getSubarray(ControllerExtension::getRow(*currentPayload))] != Row::NO_ROW;
+
+    return state == State::Activated;
+}
+
+Row BankMachine::getTargetOpenRow() const
+{
+    if (subarrayLevelParallelism)
+        return openRowInSubarray[memSpec.getSubarray(ControllerExtension::getRow(*currentPayload))];
+
+    return openRow;
+}
+
+void BankMachine::closeSubarray(Row row)
+{
+    Row& subarrayRow = openRowInSubarray[memSpec.getSubarray(row)];
+    if (subarrayRow != Row::NO_ROW)
+    {
+        subarrayRow = Row::NO_ROW;
+        activatedSubarrays--;
+    }
+
+    if (activatedSubarrays == 0)
+        state = State::Precharged;
+}
+
 bool BankMachine::isIdle() const
 {
     return (currentPayload == nullptr);
@@ -189,11 +247,11 @@ void BankMachineOpen::evaluate()
                 currentPayload = newPayload;
             }
 
-            if (state == State::Precharged) // bank precharged
+            if (!isTargetActivated()) // bank (or subarray) precharged
                 nextCommand = Command::ACT;
-            else if (state == State::Activated)
+            else
             {
-                if (ControllerExtension::getRow(*currentPayload) == openRow) // row hit
+                if (ControllerExtension::getRow(*currentPayload) == getTargetOpenRow()) // row hit
                 {
                     assert(currentPayload->is_read() || currentPayload->is_write());
                     if (currentPayload->is_read())
@@ -235,9 +293,9 @@ void BankMachineClosed::evaluate()
                 currentPayload = newPayload;
             }
 
-            if (state == State::Precharged) // bank precharged
+            if (!isTargetActivated()) // bank (or subarray) precharged
                 nextCommand = Command::ACT;
-            else if (state == State::Activated)
+            else
             {
                 assert(currentPayload->is_read() || currentPayload->is_write());
                 if (currentPayload->is_read())
@@ -276,14 +334,14 @@ void BankMachineOpenAdaptive::evaluate()
                 currentPayload = newPayload;
             }
 
-            if (state == State::Precharged) // bank precharged
+            if (!isTargetActivated()) // bank (or subarray) precharged
                 nextCommand = Command::ACT;
-            else if (state == State::Activated)
+            else
             {
-                if (ControllerExtension::getRow(*currentPayload) == openRow) // row hit
+                if (ControllerExtension::getRow(*currentPayload) == getTargetOpenRow()) // row hit
                 {
                     if (scheduler.hasFurtherRequest(bank, currentPayload->get_command())
-                        && !scheduler.hasFurtherRowHit(bank, openRow, currentPayload->get_command()))
+                        && !scheduler.hasFurtherRowHit(bank, getTargetOpenRow(), currentPayload->get_command()))
                     {
                         assert(currentPayload->is_read() || currentPayload->is_write());
                         if (currentPayload->is_read())
@@ -335,13 +393,13 @@ void BankMachineClosedAdaptive::evaluate()
                 currentPayload = newPayload;
             }
 
-            if (state == State::Precharged) // bank precharged
+            if (!isTargetActivated()) // bank (or subarray) precharged
                 nextCommand = Command::ACT;
-            else if (state == State::Activated)
+            else
             {
-                if (ControllerExtension::getRow(*currentPayload) == openRow) // row hit
+                if (ControllerExtension::getRow(*currentPayload) == getTargetOpenRow()) // row hit
                 {
-                    if (scheduler.hasFurtherRowHit(bank, openRow, currentPayload->get_command()))
+                    if (scheduler.hasFurtherRowHit(bank, getTargetOpenRow(), currentPayload->get_command()))
                     {
                         assert(currentPayload->is_read() || currentPayload->is_write());
                         if (currentPayload->is_read())
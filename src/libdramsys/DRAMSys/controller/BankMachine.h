@@ -45,6 +45,7 @@
 
 #include <systemc>
 #include <tlm>
+#include <vector>
 
 namespace DRAMSys
 {
@@ -60,6 +61,7 @@ public:
     [[nodiscard]] BankGroup getBankGroup() const;
     [[nodiscard]] Bank getBank() const;
     [[nodiscard]] Row getOpenRow() const;
+    [[nodiscard]] bool isRowOpen(Row row) const;
     [[nodiscard]] bool isIdle() const;
     [[nodiscard]] bool isActivated() const;
     [[nodiscard]] bool isPrecharged() const;
@@ -81,6 +83,14 @@ protected:
     unsigned refreshManagementCounter = 0;
     const bool refreshManagement = false;
     bool keepTrans = false;
+
+    // Subarray-level parallelism: one open row per subarray, state and openRow refer to the whole bank
+    const bool subarrayLevelParallelism;
+    std::vector<Row> openRowInSubarray;
+    unsigned activatedSubarrays = 0;
+    [[nodiscard]] bool isTargetActivated() const;
+    [[nodiscard]] Row getTargetOpenRow() const;
+    void closeSubarray(Row row);
 };
 
 class BankMachineOpen final : public BankMachine
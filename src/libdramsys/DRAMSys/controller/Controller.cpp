@@ -44,13 +44,16 @@
 #include "DRAMSys/controller/checker/CheckerGDDR5X.h"
 #include "DRAMSys/controller/checker/CheckerGDDR6.h"
 #include "DRAMSys/controller/checker/CheckerSTTMRAM.h"
+#include "DRAMSys/controller/scheduler/SchedulerEdf.h"
 #include "DRAMSys/controller/scheduler/SchedulerFifo.h"
 #include "DRAMSys/controller/scheduler/SchedulerFrFcfs.h"
 #include "DRAMSys/controller/scheduler/SchedulerFrFcfsGrp.h"
 #include "DRAMSys/controller/scheduler/SchedulerGrpFrFcfs.h"
 #include "DRAMSys/controller/scheduler/SchedulerGrpFrFcfsWm.h"
+#include "DRAMSys/controller/scheduler/SchedulerReadPriority.h"
 #include "DRAMSys/controller/cmdmux/CmdMuxStrict.h"
 #include "DRAMSys/controller/cmdmux/CmdMuxOldest.h"
+#include "DRAMSys/controller/cmdmux/CmdMuxBankGroup.h"
 #include "DRAMSys/controller/respqueue/RespQueueFifo.h"
 #include "DRAMSys/controller/respqueue/RespQueueReorder.h"
 #include "DRAMSys/controller/refresh/RefreshManagerDummy.h"
@@ -58,10 +61,17 @@
 #include "DRAMSys/controller/refresh/RefreshManagerPerBank.h"
 #include "DRAMSys/controller/refresh/RefreshManagerPer2Bank.h"
 #include "DRAMSys/controller/refresh/RefreshManagerSameBank.h"
+#include "DRAMSys/controller/refresh/RefreshManagerRetention.h"
 #include "DRAMSys/controller/powerdown/PowerDownManagerStaggered.h"
 #include "DRAMSys/controller/powerdown/PowerDownManagerDummy.h"
 #include "DRAMSys/configuration/Configuration.h"
 #include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/common/EventLog.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
 
 #ifdef DDR5_SIM
 #include "DRAMSys/controller/checker/CheckerDDR5.h"
@@ -85,21 +95,40 @@ Controller::Controller(const sc_module_name& name, const Configuration& config,
     phyDelayFw(config.phyDelayFw), phyDelayBw(config.phyDelayBw),
     blockingReadDelay(config.blockingReadDelay), blockingWriteDelay(config.blockingWriteDelay),
     minBytesPerBurst(config.memSpec->defaultBytesPerBurst),
-    maxBytesPerBurst(config.memSpec->maxBytesPerBurst)
+    maxBytesPerBurst(config.memSpec->maxBytesPerBurst),
+    fingerprintInterval(config.commandFingerprintInterval),
+    fingerprintFileName(config.simulationName + "_" + this->name() + "_fingerprint.txt"),
+    powerDownBatchDelay(config.powerDownPolicy == Configuration::PowerDownPolicy::Staggered
+                        ? config.powerDownBatchDelay : SC_ZERO_TIME),
+    powerDownBatchSize(config.powerDownBatchSize),
+    powerDownBatchDepth(config.powerDownBatchDepth),
+    ingressQueueSize(config.ingressQueueSize), ingressQueue(config.ingressQueueSize)
 {
     SC_METHOD(controllerMethod);
     sensitive << beginReqEvent << endRespEvent << controllerEvent << dataResponseEvent;
     
     ranksNumberOfPayloads = std::vector<unsigned>(memSpec.ranksPerChannel);
+    rankWakeUpTime = std::vector<sc_time>(memSpec.ranksPerChannel, scMaxTime);
+    rankFirstRequestTime = std::vector<sc_time>(memSpec.ranksPerChannel, scMaxTime);
+    batchedWakeUps = std::vector<uint64_t>(memSpec.ranksPerChannel, 0);
+    batchedWakeUpDelay = std::vector<sc_time>(memSpec.ranksPerChannel, SC_ZERO_TIME);
 
     // reserve buffer for command tuples
     readyCommands.reserve(memSpec.banksPerChannel);
 
+    if (config.subarrayLevelParallelism)
+    {
+        if (memSpec.memoryType != MemSpec::MemoryType::DDR4)
+            SC_REPORT_FATAL("Controller", "Subarray-level parallelism is only supported in DDR4!");
+        if (memSpec.subarraysPerBank < 2)
+            SC_REPORT_FATAL("Controller", "Subarray-level parallelism requires at least two subarrays per bank!");
+    }
+
     // instantiate timing checker
     if (memSpec.memoryType == MemSpec::MemoryType::DDR3)
         checker = std::make_unique<CheckerDDR3>(config);
     else if (memSpec.memoryType == MemSpec::MemoryType::DDR4)
-        checker = std::make_unique<CheckerDDR4>(config);
+        checker = createCheckerDDR4(config);
     else if (memSpec.memoryType == MemSpec::MemoryType::WideIO)
         checker = std::make_unique<CheckerWideIO>(config);
     else if (memSpec.memoryType == MemSpec::MemoryType::LPDDR4)
@@ -141,6 +170,10 @@ Controller::Controller(const sc_module_name& name, const Configuration& config,
         scheduler = std::make_unique<SchedulerGrpFrFcfs>(config);
     else if (config.scheduler == Configuration::Scheduler::GrpFrFcfsWm)
         scheduler = std::make_unique<SchedulerGrpFrFcfsWm>(config);
+    else if (config.scheduler == Configuration::Scheduler::Edf)
+        scheduler = std::make_unique<SchedulerEdf>(config);
+    else if (config.scheduler == Configuration::Scheduler::ReadPriority)
+        scheduler = std::make_unique<SchedulerReadPriority>(config);
 
     if (config.cmdMux == Configuration::CmdMux::Oldest)
     {
@@ -156,6 +189,13 @@ Controller::Controller(const sc_module_name& name, const Configuration& config,
         else
             cmdMux = std::make_unique<CmdMuxStrict>(config);
     }
+    else if (config.cmdMux == Configuration::CmdMux::BankGroup)
+    {
+        if (memSpec.hasRasAndCasBus())
+            cmdMux = std::make_unique<CmdMuxBankGroupRasCas>(config);
+        else
+            cmdMux = std::make_unique<CmdMuxBankGroup>(config);
+    }
 
     if (config.respQueue == Configuration::RespQueue::Fifo)
         respQueue = std::make_unique<RespQueueFifo>();
@@ -225,6 +265,14 @@ Controller::Controller(const sc_module_name& name, const Configuration& config,
                     (config, bankMachinesOnRank[rankID], *powerDownManagers[rankID].get(), Rank(rankID)));
         }
     }
+    else if (config.refreshPolicy == Configuration::RefreshPolicy::Retention)
+    {
+        for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
+        {
+            refreshManagers.emplace_back(std::make_unique<RefreshManagerRetention>
+                    (config, bankMachinesOnRank[rankID], *powerDownManagers[rankID].get(), Rank(rankID)));
+        }
+    }
     else if (config.refreshPolicy == Configuration::RefreshPolicy::SameBank)
     {
         for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
@@ -255,6 +303,171 @@ Controller::Controller(const sc_module_name& name, const Configuration& config,
         SC_REPORT_FATAL("Controller", "Selected refresh mode not supported!");
 }
 
+void Controller::end_of_simulation()
+{
+    ControllerIF::end_of_simulation();
+    scheduler->printStatistics(name());
+    checker->printStatistics(name());
+    cmdMux->printStatistics(name());
+    for (const auto& refreshManager : refreshManagers)
+        refreshManager->printStatistics(name());
+
+    // The power-down residency is reported by the PowerDownStatistics listener of DRAMSys
+    if (powerDownBatchDelay != SC_ZERO_TIME)
+    {
+        for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
+        {
+            std::cout << name() << std::string("  Power-down rank ") << rankID << ": "
+                      << batchedWakeUps[rankID] << " batched wake-ups, AVG delay "
+                      << (batchedWakeUps[rankID] == 0 ? SC_ZERO_TIME
+                          : batchedWakeUpDelay[rankID] / static_cast<double>(batchedWakeUps[rankID]))
+                      << std::endl;
+        }
+    }
+
+    for (unsigned threadID = 0; threadID < deadlineRequests.size(); threadID++)
+    {
+        if (deadlineRequests[threadID] == 0)
+            continue;
+
+        std::cout << name() << std::string("  Deadlines thread ") << threadID << ": "
+                  << deadlineRequests[threadID] << " requests, " << deadlineMisses[threadID] << " misses ("
+                  << std::fixed << std::setprecision(2)
+                  << static_cast<double>(deadlineMisses[threadID]) / static_cast<double>(deadlineRequests[threadID]) * 100.0
+                  << " %), AVG lateness "
+                  << (deadlineMisses[threadID] == 0 ? SC_ZERO_TIME
+                      : deadlineLateness[threadID] / static_cast<double>(deadlineMisses[threadID]))
+                  << std::endl;
+    }
+
+    if (ingressQueueSize > 0)
+    {
+        std::cout << name() << std::string("  Ingress queue:  ") << ingressQueue.getBypasses()
+                  << " requests bypassed an older waiting request" << std::endl;
+    }
+
+    if (fingerprintInterval > 0)
+    {
+        std::cout << name() << std::string("  Fingerprint:    ")
+                  << "0x" << std::hex << std::setw(16) << std::setfill('0') << fingerprint
+                  << std::dec << std::setfill(' ')
+                  << " (" << fingerprintedCommands << " commands, "
+                  << fingerprintCheckpoints.size() << " checkpoints in " << fingerprintFileName << ")"
+                  << std::endl;
+
+        std::ofstream file(fingerprintFileName);
+        if (!file)
+        {
+            SC_REPORT_WARNING("Controller", ("Could not write " + fingerprintFileName).c_str());
+            return;
+        }
+
+        file << std::hex << std::setfill('0');
+        for (std::size_t checkpoint = 0; checkpoint < fingerprintCheckpoints.size(); checkpoint++)
+        {
+            file << std::dec << (checkpoint + 1) * fingerprintInterval << " 0x"
+                 << std::hex << std::setw(16) << fingerprintCheckpoints[checkpoint] << std::endl;
+        }
+        file << std::dec << fingerprintedCommands << " 0x" << std::hex << std::setw(16) << fingerprint << std::endl;
+    }
+}
+
+void Controller::acquireRank(Rank rank)
+{
+    if (ranksNumberOfPayloads[rank.ID()] == 0)
+    {
+        // Only a rank that is actually powered down is kept asleep, and only while the queue is shallow
+        if (powerDownBatchDelay != SC_ZERO_TIME && powerDownBatchSize > 1
+            && powerDownManagers[rank.ID()]->isInPowerDown() && isQueueShallow())
+        {
+            rankFirstRequestTime[rank.ID()] = sc_time_stamp();
+            rankWakeUpTime[rank.ID()] = sc_time_stamp() + powerDownBatchDelay;
+            powerDownManagers[rank.ID()]->triggerHold();
+        }
+        else
+            powerDownManagers[rank.ID()]->triggerExit();
+    }
+    else if (rankWakeUpTime[rank.ID()] != scMaxTime
+             && (ranksNumberOfPayloads[rank.ID()] + 1 >= powerDownBatchSize || !isQueueShallow()))
+    {
+        wakeUpRank(rank);
+    }
+
+    ranksNumberOfPayloads[rank.ID()]++;
+}
+
+bool Controller::isQueueShallow() const
+{
+    const std::vector<unsigned>& bufferDepth = scheduler->getBufferDepth();
+    return std::accumulate(bufferDepth.begin(), bufferDepth.end(), 0U) < powerDownBatchDepth;
+}
+
+void Controller::wakeUpRank(Rank rank)
+{
+    powerDownManagers[rank.ID()]->triggerExit();
+    batchedWakeUps[rank.ID()]++;
+    batchedWakeUpDelay[rank.ID()] += sc_time_stamp() - rankFirstRequestTime[rank.ID()];
+    rankWakeUpTime[rank.ID()] = scMaxTime;
+}
+
+void Controller::recordDeadline(const tlm_generic_payload& trans, const sc_time& responseTime)
+{
+    sc_time deadline = DeadlineExtension::getDeadline(trans);
+    if (deadline == scMaxTime)
+        return;
+
+    unsigned threadID = ArbiterExtension::getThread(trans).ID();
+    if (threadID >= deadlineRequests.size())
+    {
+        deadlineRequests.resize(threadID + 1, 0);
+        deadlineMisses.resize(threadID + 1, 0);
+        deadlineLateness.resize(threadID + 1, SC_ZERO_TIME);
+    }
+
+    deadlineRequests[threadID]++;
+    if (responseTime > deadline)
+    {
+        deadlineMisses[threadID]++;
+        deadlineLateness[threadID] += responseTime - deadline;
+    }
+}
+
+void Controller::publishResponse(const tlm_generic_payload& trans, const sc_time& responseTime)
+{
+    if (probeBus != nullptr && probeBus->isSubscribed(ProbeEvent::Type::ResponseSent))
+    {
+        ProbeEvent event(ProbeEvent::Type::ResponseSent, this, responseTime, trans);
+        event.thread = ArbiterExtension::getThread(trans).ID();
+        event.channel = ArbiterExtension::getChannel(trans).ID();
+        probeBus->publish(event);
+    }
+}
+
+void Controller::updateFingerprint(Command command, const tlm_generic_payload& trans)
+{
+    // 64-bit finalizer of splitmix64, applied after each word so that the hash depends on the order
+    auto mix = [](uint64_t value)
+    {
+        value = (value ^ (value >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+        value = (value ^ (value >> 27)) * UINT64_C(0x94d049bb133111eb);
+        return value ^ (value >> 31);
+    };
+
+    uint64_t cycle = sc_time_stamp().value() / memSpec.tCK.value();
+    uint64_t commandAndBank = static_cast<uint64_t>(static_cast<uint8_t>(command))
+            | (static_cast<uint64_t>(ControllerExtension::getBank(trans).ID()) << 8);
+    uint64_t rowAndColumn = static_cast<uint64_t>(ControllerExtension::getRow(trans).ID())
+            | (static_cast<uint64_t>(ControllerExtension::getColumn(trans).ID()) << 32);
+
+    fingerprint = mix(fingerprint ^ commandAndBank);
+    fingerprint = mix(fingerprint ^ rowAndColumn);
+    fingerprint = mix(fingerprint ^ cycle);
+
+    fingerprintedCommands++;
+    if (fingerprintedCommands % fingerprintInterval == 0)
+        fingerprintCheckpoints.push_back(fingerprint);
+}
+
 void Controller::controllerMethod()
 {
     if (isFullCycle(sc_time_stamp()))
@@ -267,6 +480,14 @@ void Controller::controllerMethod()
     }
 
     // (3) Start refresh and power-down managers to issue requests for the current time
+    for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
+    {
+        // A refresh may have interrupted the power-down in the meantime
+        if (rankWakeUpTime[rankID] != scMaxTime
+            && (sc_time_stamp() >= rankWakeUpTime[rankID] || !powerDownManagers[rankID]->isInPowerDown()
+                || !isQueueShallow()))
+            wakeUpRank(Rank(rankID));
+    }
     for (auto& it : refreshManagers)
         it->evaluate();
     for (auto& it : powerDownManagers)
@@ -341,6 +562,19 @@ void Controller::controllerMethod()
             powerDownManagers[rank.ID()]->update(command);
             checker->insert(command, *trans);
 
+            LOGEVENT(eventLog, eventLogOrigin, EventLog::Event::ControllerCommand, static_cast<uint8_t>(command), bank.ID(),
+                     ControllerExtension::getChannelPayloadID(*trans));
+            if (probeBus != nullptr && probeBus->isSubscribed(ProbeEvent::Type::CommandIssued))
+            {
+                ProbeEvent event(ProbeEvent::Type::CommandIssued, this, sc_time_stamp(), *trans);
+                event.rank = rank.ID();
+                event.bank = bank.ID();
+                event.command = command;
+                probeBus->publish(event);
+            }
+            if (fingerprintInterval > 0)
+                updateFingerprint(command, *trans);
+
             if (command.isCasCommand())
             {
                 scheduler->removeRequest(*trans);
@@ -414,6 +648,9 @@ void Controller::controllerMethod()
         }
     }
 
+    for (const auto& wakeUpTime : rankWakeUpTime)
+        timeForNextTrigger = std::min(timeForNextTrigger, wakeUpTime);
+
     if (timeForNextTrigger != scMaxTime)
         controllerEvent.notify(timeForNextTrigger - sc_time_stamp());
 }
@@ -459,73 +696,147 @@ unsigned int Controller::transport_dbg(tlm_generic_payload& trans)
 
 void Controller::manageRequests(const sc_time& delay)
 {
-    if (transToAcquire.payload != nullptr && transToAcquire.arrival <= sc_time_stamp())
+    if (ingressQueueSize == 0)
     {
-        // TODO: here we assume that the scheduler always has space not only for a single burst transaction
-        //  but for a maximum size transaction
-        if (scheduler->hasBufferSpace())
+        if (transToAcquire.payload != nullptr && transToAcquire.arrival <= sc_time_stamp())
         {
-            if (totalNumberOfPayloads == 0)
-                idleTimeCollector.end();
-            totalNumberOfPayloads++;  // seems to be ok
-
-            transToAcquire.payload->acquire();
-
-            // Align address to minimum burst length
-            uint64_t alignedAddress = transToAcquire.payload->get_address() & ~(minBytesPerBurst - UINT64_C(1));
-            transToAcquire.payload->set_address(alignedAddress);
-
-            // continuous block of data that can be fetched with a single burst
-            if ((alignedAddress / maxBytesPerBurst)
-                    == ((alignedAddress + transToAcquire.payload->get_data_length() - 1) / maxBytesPerBurst))
+            if (hasBufferSpace(*transToAcquire.payload))
             {
-                DecodedAddress decodedAddress = addressDecoder.decodeAddress(transToAcquire.payload->get_address());
-                ControllerExtension::setAutoExtension(*transToAcquire.payload, nextChannelPayloadIDToAppend++,
-                                                      Rank(decodedAddress.rank), BankGroup(decodedAddress.bankgroup),
-                                                      Bank(decodedAddress.bank), Row(decodedAddress.row),
-                                                      Column(decodedAddress.column),
-                                                      transToAcquire.payload->get_data_length() / memSpec.bytesPerBeat);
-
-                Rank rank = Rank(decodedAddress.rank);
-                if (ranksNumberOfPayloads[rank.ID()] == 0)
-                    powerDownManagers[rank.ID()]->triggerExit();
-                ranksNumberOfPayloads[rank.ID()]++;
-
-                scheduler->storeRequest(*transToAcquire.payload);
-                Bank bank = Bank(decodedAddress.bank);
-                bankMachines[bank.ID()]->evaluate();
+                acceptRequest(*transToAcquire.payload);
+                storeRequest(*transToAcquire.payload);
+                sendEndRequest(*transToAcquire.payload, delay);
+                transToAcquire.payload = nullptr;
             }
             else
             {
-                createChildTranses(*transToAcquire.payload);
-                const std::vector<tlm_generic_payload*>& childTranses =
-                        transToAcquire.payload->get_extension<ParentExtension>()->getChildTranses();
-                for (auto* childTrans : childTranses)
-                {
-                    Rank rank = ControllerExtension::getRank(*childTrans);
-                    if (ranksNumberOfPayloads[rank.ID()] == 0)
-                        powerDownManagers[rank.ID()]->triggerExit();
-                    ranksNumberOfPayloads[rank.ID()]++;
-
-                    scheduler->storeRequest(*childTrans);
-                    Bank bank = ControllerExtension::getBank(*childTrans);
-                    bankMachines[bank.ID()]->evaluate();
-                }
+                PRINTDEBUGMESSAGE(name(), "Total number of payloads exceeded, backpressure!");
             }
+        }
+        return;
+    }
+
+    // With an ingress queue the request is acknowledged as soon as the queue has space and
+    // enters the scheduler once the buffer of its own bank has space
+    bool accepted = acceptIngressRequest(delay);
+    bool admitted = admitIngressRequests();
+    if (!accepted && admitted)
+        acceptIngressRequest(delay);
+}
+
+bool Controller::hasBufferSpace(const tlm_generic_payload& trans) const
+{
+    // TODO: here we assume that the scheduler always has space not only for a single burst transaction
+    //  but for a maximum size transaction
+    uint64_t alignedAddress = trans.get_address() & ~(minBytesPerBurst - UINT64_C(1));
+    return scheduler->hasBufferSpace(Bank(addressDecoder.decodeAddress(alignedAddress).bank));
+}
+
+void Controller::acceptRequest(tlm_generic_payload& trans)
+{
+    if (totalNumberOfPayloads == 0)
+        idleTimeCollector.end();
+    totalNumberOfPayloads++;  // seems to be ok
+
+    trans.acquire();
+}
+
+void Controller::sendEndRequest(tlm_generic_payload& trans, const sc_time& delay)
+{
+    trans.set_response_status(TLM_OK_RESPONSE);
+    tlm_phase bwPhase = END_REQ;
+    sc_time bwDelay = delay;
+    sendToFrontend(trans, bwPhase, bwDelay);
+}
+
+void Controller::storeRequest(tlm_generic_payload& trans)
+{
+    // Align address to minimum burst length
+    uint64_t alignedAddress = trans.get_address() & ~(minBytesPerBurst - UINT64_C(1));
+    trans.set_address(alignedAddress);
+
+    // continuous block of data that can be fetched with a single burst
+    if (isSingleBurst(trans))
+    {
+        DecodedAddress decodedAddress = addressDecoder.decodeAddress(trans.get_address());
+        ControllerExtension::setAutoExtension(trans, nextChannelPayloadIDToAppend++,
+                                              Rank(decodedAddress.rank), BankGroup(decodedAddress.bankgroup),
+                                              Bank(decodedAddress.bank), Row(decodedAddress.row),
+                                              Column(decodedAddress.column),
+                                              trans.get_data_length() / memSpec.bytesPerBeat);
+
+        acquireRank(Rank(decodedAddress.rank));
 
-            transToAcquire.payload->set_response_status(TLM_OK_RESPONSE);
-            tlm_phase bwPhase = END_REQ;
-            sc_time bwDelay = delay;
-            sendToFrontend(*transToAcquire.payload, bwPhase, bwDelay);
-            transToAcquire.payload = nullptr;
+        scheduler->storeRequest(trans);
+        LOGEVENT(eventLog, eventLogOrigin, EventLog::Event::ControllerBeginReq, nextChannelPayloadIDToAppend - 1,
+                 decodedAddress.bank, decodedAddress.row);
+        if (probeBus != nullptr && probeBus->isSubscribed(ProbeEvent::Type::RequestAccepted))
+        {
+            ProbeEvent event(ProbeEvent::Type::RequestAccepted, this, sc_time_stamp(), trans);
+            event.rank = static_cast<unsigned>(decodedAddress.rank);
+            event.bank = static_cast<unsigned>(decodedAddress.bank);
+            probeBus->publish(event);
         }
-        else
+        Bank bank = Bank(decodedAddress.bank);
+        bankMachines[bank.ID()]->evaluate();
+    }
+    else
+    {
+        createChildTranses(trans);
+        const std::vector<tlm_generic_payload*>& childTranses =
+                trans.get_extension<ParentExtension>()->getChildTranses();
+        for (auto* childTrans : childTranses)
         {
-            PRINTDEBUGMESSAGE(name(), "Total number of payloads exceeded, backpressure!");
+            acquireRank(ControllerExtension::getRank(*childTrans));
+
+            scheduler->storeRequest(*childTrans);
+            LOGEVENT(eventLog, eventLogOrigin, EventLog::Event::ControllerBeginReq,
+                     ControllerExtension::getChannelPayloadID(*childTrans),
+                     ControllerExtension::getBank(*childTrans).ID(), ControllerExtension::getRow(*childTrans).ID());
+            if (probeBus != nullptr && probeBus->isSubscribed(ProbeEvent::Type::RequestAccepted))
+            {
+                ProbeEvent event(ProbeEvent::Type::RequestAccepted, this, sc_time_stamp(), *childTrans);
+                event.rank = ControllerExtension::getRank(*childTrans).ID();
+                event.bank = ControllerExtension::getBank(*childTrans).ID();
+                probeBus->publish(event);
+            }
+            Bank bank = ControllerExtension::getBank(*childTrans);
+            bankMachines[bank.ID()]->evaluate();
         }
     }
 }
 
+bool Controller::isSingleBurst(const tlm_generic_payload& trans) const
+{
+    uint64_t alignedAddress = trans.get_address() & ~(minBytesPerBurst - UINT64_C(1));
+    return (alignedAddress / maxBytesPerBurst)
+           == ((alignedAddress + trans.get_data_length() - 1) / maxBytesPerBurst);
+}
+
+bool Controller::acceptIngressRequest(const sc_time& delay)
+{
+    if (transToAcquire.payload == nullptr || transToAcquire.arrival > sc_time_stamp())
+        return false;
+
+    if (ingressQueue.isFull())
+    {
+        PRINTDEBUGMESSAGE(name(), "Ingress queue full, backpressure!");
+        return false;
+    }
+
+    acceptRequest(*transToAcquire.payload);
+    sendEndRequest(*transToAcquire.payload, delay);
+    ingressQueue.push(*transToAcquire.payload);
+    transToAcquire.payload = nullptr;
+    return true;
+}
+
+bool Controller::admitIngressRequests()
+{
+    return ingressQueue.admit([this](const tlm_generic_payload& trans) { return isSingleBurst(trans); },
+                              [this](const tlm_generic_payload& trans) { return hasBufferSpace(trans); },
+                              [this](tlm_generic_payload& trans) { storeRequest(trans); });
+}
+
 void Controller::manageResponses()
 {
     if (transToRelease.payload != nullptr)
@@ -566,6 +877,10 @@ void Controller::manageResponses()
                 else
                     bwDelay = SC_ZERO_TIME;
 
+                LOGEVENT(eventLog, eventLogOrigin, EventLog::Event::ControllerBeginResp, transToRelease.payload->get_address(),
+                         transToRelease.payload->get_data_length());
+                recordDeadline(*transToRelease.payload, sc_time_stamp() + bwDelay);
+                publishResponse(*transToRelease.payload, sc_time_stamp() + bwDelay);
                 sendToFrontend(*transToRelease.payload, bwPhase, bwDelay);
                 transToRelease.arrival = scMaxTime;
             }
@@ -586,6 +901,10 @@ void Controller::manageResponses()
             else
                 bwDelay = SC_ZERO_TIME;
 
+            LOGEVENT(eventLog, eventLogOrigin, EventLog::Event::ControllerBeginResp, transToRelease.payload->get_address(),
+                     transToRelease.payload->get_data_length());
+            recordDeadline(*transToRelease.payload, sc_time_stamp() + bwDelay);
+            publishResponse(*transToRelease.payload, sc_time_stamp() + bwDelay);
             sendToFrontend(*transToRelease.payload, bwPhase, bwDelay);
             transToRelease.arrival = scMaxTime;
         }
@@ -670,8 +989,13 @@ void Controller::createChildTranses(tlm::tlm_generic_payload& parentTrans)
         childTranses.push_back(&lastChildTrans);
     }
 
+    // Child requests inherit the deadline, stale deadlines of reused payloads are cleared
+    sc_time deadline = DeadlineExtension::getDeadline(parentTrans);
     for (auto* childTrans : childTranses)
     {
+        if (deadline != scMaxTime || childTrans->get_extension<DeadlineExtension>() != nullptr)
+            DeadlineExtension::setAutoExtension(*childTrans, deadline);
+
         DecodedAddress decodedAddress = addressDecoder.decodeAddress(childTrans->get_address());
         ControllerExtension::setAutoExtension(*childTrans, nextChannelPayloadIDToAppend,
                                               Rank(decodedAddress.rank), BankGroup(decodedAddress.bankgroup),
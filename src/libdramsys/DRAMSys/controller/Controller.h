@@ -38,6 +38,7 @@
 #include "DRAMSys/controller/ControllerIF.h"
 #include "DRAMSys/controller/Command.h"
 #include "DRAMSys/controller/BankMachine.h"
+#include "DRAMSys/controller/IngressQueue.h"
 #include "DRAMSys/controller/cmdmux/CmdMuxIF.h"
 #include "DRAMSys/controller/checker/CheckerIF.h"
 #include "DRAMSys/controller/refresh/RefreshManagerIF.h"
@@ -59,6 +60,8 @@ public:
     Controller(const sc_core::sc_module_name& name, const Configuration& config, const AddressDecoder& addressDecoder);
     SC_HAS_PROCESS(Controller);
 
+    void end_of_simulation() override;
+
 protected:
     tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans, tlm::tlm_phase& phase,
                                        sc_core::sc_time& delay) override;
@@ -113,6 +116,51 @@ private:
     const unsigned minBytesPerBurst;
     const unsigned maxBytesPerBurst;
 
+    // Rolling hash over the issued command stream (command, bank, row, column, cycle) with a
+    // checkpoint every fingerprintInterval commands to compare simulation runs cheaply
+    void updateFingerprint(Command command, const tlm::tlm_generic_payload& trans);
+    const unsigned fingerprintInterval;
+    const std::string fingerprintFileName;
+    uint64_t fingerprint = 0;
+    uint64_t fingerprintedCommands = 0;
+    std::vector<uint64_t> fingerprintCheckpoints;
+
+    // Power-down batching: the exit of a powered-down rank without pending requests is deferred
+    // while the scheduler holds fewer than powerDownBatchDepth requests, until powerDownBatchDelay
+    // has elapsed or powerDownBatchSize requests are pending
+    void acquireRank(Rank rank);
+    void wakeUpRank(Rank rank);
+    [[nodiscard]] bool isQueueShallow() const;
+    const sc_core::sc_time powerDownBatchDelay;
+    const unsigned powerDownBatchSize;
+    const unsigned powerDownBatchDepth;
+    std::vector<sc_core::sc_time> rankWakeUpTime;
+    std::vector<sc_core::sc_time> rankFirstRequestTime;
+    std::vector<uint64_t> batchedWakeUps;
+    std::vector<sc_core::sc_time> batchedWakeUpDelay;
+
+    // Requests with a DeadlineExtension and how many of them (and by how much) missed their
+    // deadline, indexed by thread
+    void recordDeadline(const tlm::tlm_generic_payload& trans, const sc_core::sc_time& responseTime);
+    std::vector<uint64_t> deadlineRequests;
+    std::vector<uint64_t> deadlineMisses;
+    std::vector<sc_core::sc_time> deadlineLateness;
+
+    // Incoming requests are inserted into the scheduler by storeRequest and acknowledged by
+    // sendEndRequest; with ingressQueueSize > 0 both steps are decoupled by the ingress queue so
+    // that a request to a bank with a full buffer does not block requests to other banks
+    bool hasBufferSpace(const tlm::tlm_generic_payload& trans) const;
+    bool isSingleBurst(const tlm::tlm_generic_payload& trans) const;
+    void acceptRequest(tlm::tlm_generic_payload& trans);
+    void storeRequest(tlm::tlm_generic_payload& trans);
+    void sendEndRequest(tlm::tlm_generic_payload& trans, const sc_core::sc_time& delay);
+    bool acceptIngressRequest(const sc_core::sc_time& delay);
+    bool admitIngressRequests();
+    const unsigned ingressQueueSize;
+    IngressQueue ingressQueue;
+
+    void publishResponse(const tlm::tlm_generic_payload& trans, const sc_core::sc_time& responseTime);
+
     void createChildTranses(tlm::tlm_generic_payload& parentTrans);
 
     class MemoryManager : public tlm::tlm_mm_interface
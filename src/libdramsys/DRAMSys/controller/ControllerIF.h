@@ -39,6 +39,8 @@
 
 #include "DRAMSys/configuration/Configuration.h"
 #include "DRAMSys/common/DebugManager.h"
+#include "DRAMSys/common/EventLog.h"
+#include "DRAMSys/common/ProbeBus.h"
 
 #include <iomanip>
 #include <systemc>
@@ -105,8 +107,27 @@ public:
                   << std::endl;
     }
 
+    uint64_t getNumberOfBeatsServed() const
+    {
+        return numberOfBeatsServed;
+    }
+
+    void setProbeBus(ProbeBus& bus)
+    {
+        probeBus = &bus;
+    }
+
+    void setEventLog(EventLog& log)
+    {
+        eventLog = &log;
+        eventLogOrigin = log.registerOrigin(name());
+    }
+
 protected:
     const MemSpec& memSpec;
+    ProbeBus* probeBus = nullptr;
+    EventLog* eventLog = nullptr;
+    uint32_t eventLogOrigin = 0;
 
     // Bind sockets with virtual functions
     ControllerIF(const sc_core::sc_module_name& name, const Configuration& config)
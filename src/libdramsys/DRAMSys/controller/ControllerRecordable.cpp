@@ -50,10 +50,8 @@ ControllerRecordable::ControllerRecordable(const sc_module_name& name, const Con
 {
     if (enableWindowing)
     {
-        sensitive << windowEvent;
         slidingAverageBufferDepth = std::vector<sc_time>(scheduler->getBufferDepth().size());
         windowAverageBufferDepth = std::vector<double>(scheduler->getBufferDepth().size());
-        windowEvent.notify(windowSizeTime);
         nextWindowEventTime = windowSizeTime;
     }
 }
@@ -82,6 +80,9 @@ void ControllerRecordable::controllerMethod()
 {
     if (enableWindowing)
     {
+        // Windows that ended while the controller was idle are closed retroactively
+        closeElapsedWindows(sc_time_stamp(), false);
+
         sc_time timeDiff = sc_time_stamp() - lastTimeCalled;
         lastTimeCalled = sc_time_stamp();
         const std::vector<unsigned> &bufferDepth = scheduler->getBufferDepth();
@@ -91,24 +92,10 @@ void ControllerRecordable::controllerMethod()
 
         if (sc_time_stamp() == nextWindowEventTime)
         {
-            windowEvent.notify(windowSizeTime);
             nextWindowEventTime += windowSizeTime;
-
-            for (std::size_t index = 0; index < slidingAverageBufferDepth.size(); index++)
-            {
-                windowAverageBufferDepth[index] = slidingAverageBufferDepth[index] / windowSizeTime;
-                slidingAverageBufferDepth[index] = SC_ZERO_TIME;
-            }
-
-            tlmRecorder.recordBufferDepth(sc_time_stamp().to_seconds(), windowAverageBufferDepth);
-
+            recordBufferDepthWindow(sc_time_stamp());
             Controller::controllerMethod();
-
-            uint64_t windowNumberOfBeatsServed = numberOfBeatsServed - lastNumberOfBeatsServed;
-            lastNumberOfBeatsServed = numberOfBeatsServed;
-            sc_time windowActiveTime = activeTimeMultiplier * static_cast<double>(windowNumberOfBeatsServed);
-            double windowAverageBandwidth = windowActiveTime / windowSizeTime;
-            tlmRecorder.recordBandwidth(sc_time_stamp().to_seconds(), windowAverageBandwidth);
+            recordBandwidthWindow(sc_time_stamp());
         }
         else
         {
@@ -121,4 +108,50 @@ void ControllerRecordable::controllerMethod()
     }
 }
 
+void ControllerRecordable::closeWindows()
+{
+    if (enableWindowing)
+        closeElapsedWindows(sc_time_stamp(), true);
+}
+
+void ControllerRecordable::closeElapsedWindows(const sc_time& until, bool inclusive)
+{
+    // The buffer depth and the number of served beats only change inside the controller method,
+    // so they are constant since its last call
+    const std::vector<unsigned> &bufferDepth = scheduler->getBufferDepth();
+
+    while (nextWindowEventTime < until || (inclusive && nextWindowEventTime == until))
+    {
+        sc_time windowEnd = nextWindowEventTime;
+        nextWindowEventTime += windowSizeTime;
+
+        for (std::size_t index = 0; index < slidingAverageBufferDepth.size(); index++)
+            slidingAverageBufferDepth[index] += bufferDepth[index] * (windowEnd - lastTimeCalled);
+        lastTimeCalled = windowEnd;
+
+        recordBufferDepthWindow(windowEnd);
+        recordBandwidthWindow(windowEnd);
+    }
+}
+
+void ControllerRecordable::recordBufferDepthWindow(const sc_time& windowEnd)
+{
+    for (std::size_t index = 0; index < slidingAverageBufferDepth.size(); index++)
+    {
+        windowAverageBufferDepth[index] = slidingAverageBufferDepth[index] / windowSizeTime;
+        slidingAverageBufferDepth[index] = SC_ZERO_TIME;
+    }
+
+    tlmRecorder.recordBufferDepth(windowEnd.to_seconds(), windowAverageBufferDepth);
+}
+
+void ControllerRecordable::recordBandwidthWindow(const sc_time& windowEnd)
+{
+    uint64_t windowNumberOfBeatsServed = numberOfBeatsServed - lastNumberOfBeatsServed;
+    lastNumberOfBeatsServed = numberOfBeatsServed;
+    sc_time windowActiveTime = activeTimeMultiplier * static_cast<double>(windowNumberOfBeatsServed);
+    double windowAverageBandwidth = windowActiveTime / windowSizeTime;
+    tlmRecorder.recordBandwidth(windowEnd.to_seconds(), windowAverageBandwidth);
+}
+
 } // namespace DRAMSys
@@ -51,6 +51,9 @@ public:
                          const AddressDecoder& addressDecoder, TlmRecorder& tlmRecorder);
     ~ControllerRecordable() override = default;
 
+    // Records all windows that ended until now, must be called before the recorder is finalized
+    void closeWindows();
+
 protected:
     tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans, tlm::tlm_phase& phase,
                                        sc_core::sc_time& delay) override;
@@ -64,7 +67,10 @@ protected:
 private:
     TlmRecorder& tlmRecorder;
 
-    sc_core::sc_event windowEvent;
+    void closeElapsedWindows(const sc_core::sc_time& until, bool inclusive);
+    void recordBufferDepthWindow(const sc_core::sc_time& windowEnd);
+    void recordBandwidthWindow(const sc_core::sc_time& windowEnd);
+
     const sc_core::sc_time windowSizeTime;
     sc_core::sc_time nextWindowEventTime;
     std::vector<sc_core::sc_time> slidingAverageBufferDepth;
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "IngressQueue.h"
+
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+IngressQueue::IngressQueue(unsigned capacity) : capacity(capacity) {}
+
+bool IngressQueue::isFull() const
+{
+    return queue.size() >= capacity;
+}
+
+bool IngressQueue::isEmpty() const
+{
+    return queue.empty();
+}
+
+void IngressQueue::push(tlm_generic_payload& trans)
+{
+    queue.push_back(&trans);
+}
+
+bool IngressQueue::admit(const std::function<bool(const tlm_generic_payload&)>& isSingleBurst,
+                         const std::function<bool(const tlm_generic_payload&)>& hasBufferSpace,
+                         const std::function<void(tlm_generic_payload&)>& store)
+{
+    bool admitted = false;
+    auto it = queue.begin();
+    while (it != queue.end())
+    {
+        tlm_generic_payload& trans = **it;
+        bool isHead = (it == queue.begin());
+
+        bool overlapsOlder = false;
+        for (auto older = queue.begin(); older != it; ++older)
+        {
+            if (trans.get_address() < (*older)->get_address() + (*older)->get_data_length()
+                && (*older)->get_address() < trans.get_address() + trans.get_data_length())
+            {
+                overlapsOlder = true;
+                break;
+            }
+        }
+
+        if (!overlapsOlder && (isHead || isSingleBurst(trans)) && hasBufferSpace(trans))
+        {
+            if (!isHead)
+                bypasses++;
+            store(trans);
+            it = queue.erase(it);
+            admitted = true;
+        }
+        else
+            ++it;
+    }
+    return admitted;
+}
+
+uint64_t IngressQueue::getBypasses() const
+{
+    return bypasses;
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef INGRESSQUEUE_H
+#define INGRESSQUEUE_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <tlm>
+
+namespace DRAMSys
+{
+
+// Requests that were acknowledged by the controller but not stored in the scheduler yet, in
+// arrival order. A waiting request may overtake older ones only if it does not overlap any of
+// them; requests split into several bursts are only admitted from the head of the queue.
+class IngressQueue
+{
+public:
+    explicit IngressQueue(unsigned capacity);
+
+    [[nodiscard]] bool isFull() const;
+    [[nodiscard]] bool isEmpty() const;
+    void push(tlm::tlm_generic_payload& trans);
+
+    // Passes every request that may be admitted and for which hasBufferSpace holds to store,
+    // returns whether at least one request was admitted
+    bool admit(const std::function<bool(const tlm::tlm_generic_payload&)>& isSingleBurst,
+               const std::function<bool(const tlm::tlm_generic_payload&)>& hasBufferSpace,
+               const std::function<void(tlm::tlm_generic_payload&)>& store);
+
+    // Number of requests that were admitted before an older waiting request
+    [[nodiscard]] uint64_t getBypasses() const;
+
+private:
+    const unsigned capacity;
+    std::deque<tlm::tlm_generic_payload*> queue;
+    uint64_t bypasses = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // INGRESSQUEUE_H
@@ -36,7 +36,12 @@
 
 #include "DRAMSys/common/DebugManager.h"
 
+#ifdef DRAMSYS_GENERATED_TIMINGS
+#include "DRAMSys/controller/checker/GeneratedTimingsDDR4.h"
+#endif
+
 #include <algorithm>
+#include <tuple>
 
 using namespace sc_core;
 using namespace tlm;
@@ -44,14 +49,68 @@ using namespace tlm;
 namespace DRAMSys
 {
 
-CheckerDDR4::CheckerDDR4(const Configuration& config)
+#ifndef DRAMSYS_GENERATED_TIMINGS
+using GeneratedTimingsDDR4 = std::tuple<>;
+#endif
+
+TimingsDDR4::TimingsDDR4(const MemSpecDDR4& memSpec)
+    : tACTPDEN(memSpec.tACTPDEN),
+      tAL(memSpec.tAL),
+      tCCD_L(memSpec.tCCD_L),
+      tCCD_S(memSpec.tCCD_S),
+      tCK(memSpec.tCK),
+      tCKE(memSpec.tCKE),
+      tCKESR(memSpec.tCKESR),
+      tFAW(memSpec.tFAW),
+      tPD(memSpec.tPD),
+      tPRPDEN(memSpec.tPRPDEN),
+      tRAS(memSpec.tRAS),
+      tRC(memSpec.tRC),
+      tRCD(memSpec.tRCD),
+      tREFPDEN(memSpec.tREFPDEN),
+      tRFC(memSpec.tRFC),
+      tRL(memSpec.tRL),
+      tRP(memSpec.tRP),
+      tRPRE(memSpec.tRPRE),
+      tRRD_L(memSpec.tRRD_L),
+      tRRD_S(memSpec.tRRD_S),
+      tRTP(memSpec.tRTP),
+      tRTRS(memSpec.tRTRS),
+      tWL(memSpec.tWL),
+      tWPRE(memSpec.tWPRE),
+      tWR(memSpec.tWR),
+      tWTR_L(memSpec.tWTR_L),
+      tWTR_S(memSpec.tWTR_S),
+      tXP(memSpec.tXP),
+      tXS(memSpec.tXS),
+      tXSDLL(memSpec.tXSDLL)
+{
+    tBURST = memSpec.defaultBurstLength / memSpec.dataRate * tCK;
+    tRDWR = tRL + tBURST + tCK - tWL + tWPRE;
+    tRDWR_R = tRL + tBURST + tRTRS - tWL + tWPRE;
+    tWRRD_S = tWL + tBURST + tWTR_S - tAL;
+    tWRRD_L = tWL + tBURST + tWTR_L - tAL;
+    tWRRD_R = tWL + tBURST + tRTRS - tRL + tRPRE;
+    tWRPRE = tWL + tBURST + tWR;
+    tRDPDEN = tRL + tBURST + tCK;
+    tWRPDEN = tWL + tBURST + tWR;
+    tWRAPDEN = tWL + tBURST + tCK + tWR;
+    tRDASREFEN = std::max(tRDPDEN, tAL + tRTP + tRP);
+    tWRASREFEN = std::max(tWRAPDEN, tWRPRE + tRP);
+}
+
+template <typename Timings>
+CheckerDDR4<Timings>::CheckerDDR4(const Configuration& config)
+    : memSpec(static_cast<const MemSpecDDR4 *>(config.memSpec.get())), timing(*memSpec),
+      subarrayLevelParallelism(config.subarrayLevelParallelism)
 {
-    memSpec = dynamic_cast<const MemSpecDDR4 *>(config.memSpec.get());
-    if (memSpec == nullptr)
-        SC_REPORT_FATAL("CheckerDDR4", "Wrong MemSpec chosen");
-    
     lastScheduledByCommandAndBank = std::vector<std::vector<sc_time>>
             (Command::numberOfCommands(), std::vector<sc_time>(memSpec->banksPerChannel, scMaxTime));
+    if (subarrayLevelParallelism)
+    {
+        lastScheduledByCommandAndSubarray = std::vector<std::vector<sc_time>>(Command::numberOfCommands(),
+                std::vector<sc_time>(memSpec->banksPerChannel * memSpec->subarraysPerBank, scMaxTime));
+    }
     lastScheduledByCommandAndBankGroup = std::vector<std::vector<sc_time>>
             (Command::numberOfCommands(), std::vector<sc_time>(memSpec->bankGroupsPerChannel, scMaxTime));
     lastScheduledByCommandAndRank = std::vector<std::vector<sc_time>>
@@ -59,20 +118,11 @@ CheckerDDR4::CheckerDDR4(const Configuration& config)
     lastScheduledByCommand = std::vector<sc_time>(Command::numberOfCommands(), scMaxTime);
     lastCommandOnBus = scMaxTime;
     last4Activates = std::vector<std::queue<sc_time>>(memSpec->ranksPerChannel);
-    
-    tBURST = memSpec->defaultBurstLength / memSpec->dataRate * memSpec->tCK;
-    tRDWR = memSpec->tRL + tBURST + memSpec->tCK - memSpec->tWL + memSpec->tWPRE;
-    tRDWR_R = memSpec->tRL + tBURST + memSpec->tRTRS - memSpec->tWL + memSpec->tWPRE;
-    tWRRD_S = memSpec->tWL + tBURST + memSpec->tWTR_S - memSpec->tAL;
-    tWRRD_L = memSpec->tWL + tBURST + memSpec->tWTR_L - memSpec->tAL;
-    tWRRD_R = memSpec->tWL + tBURST + memSpec->tRTRS - memSpec->tRL + memSpec->tRPRE;
-    tWRPRE = memSpec->tWL + tBURST + memSpec->tWR;
-    tRDPDEN = memSpec->tRL + tBURST + memSpec->tCK;
-    tWRPDEN = memSpec->tWL + tBURST + memSpec->tWR;
-    tWRAPDEN = memSpec->tWL + tBURST + memSpec->tCK + memSpec->tWR;
+    lastRefreshCycleTime = std::vector<sc_time>(memSpec->ranksPerChannel, timing.tRFC);
 }
 
-sc_time CheckerDDR4::timeToSatisfyConstraints(Command command, const tlm_generic_payload& payload) const
+template <typename Timings>
+sc_time CheckerDDR4<Timings>::timeToSatisfyConstraints(Command command, const tlm_generic_payload& payload) const
 {
     Rank rank = ControllerExtension::getRank(payload);
     BankGroup bankGroup = ControllerExtension::getBankGroup(payload);
@@ -85,382 +135,383 @@ sc_time CheckerDDR4::timeToSatisfyConstraints(Command command, const tlm_generic
     {
         assert(ControllerExtension::getBurstLength(payload) == 8);
 
-        lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::ACT, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRCD - memSpec->tAL);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRCD - timing.tAL);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::RD][bankGroup.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD_L);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCCD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD_S);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCCD_S);
 
         lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : scMaxTime;
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tBURST + timing.tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::RDA][bankGroup.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD_L);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCCD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD_S);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCCD_S);
 
         lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : scMaxTime;
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tBURST + timing.tRTRS);
 
         if (command == Command::RDA)
         {
-            lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
+            lastCommandStart = lastScheduledInBank(Command::WR, bank, payload);
             if (lastCommandStart != scMaxTime)
-                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE - memSpec->tRTP - memSpec->tAL);
+                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRPRE - timing.tRTP - timing.tAL);
         }
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WR][bankGroup.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_L);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRRD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_S);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRRD_S);
 
         lastCommandStart = lastScheduledByCommand[Command::WR];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WRA][bankGroup.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_L);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRRD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_S);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRRD_S);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXSDLL);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXSDLL);
     }
     else if (command == Command::WR || command == Command::WRA)
     {
         assert(ControllerExtension::getBurstLength(payload) == 8);
 
-        lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::ACT, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRCD - memSpec->tAL);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRCD - timing.tAL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDWR);
 
         lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : scMaxTime;
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDWR);
 
         lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : scMaxTime;
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WR][bankGroup.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD_L);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCCD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD_S);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCCD_S);
 
         lastCommandStart = lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank.ID()] ? lastScheduledByCommand[Command::WR] : scMaxTime;
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tBURST + timing.tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WRA][bankGroup.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD_L);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCCD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD_S);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCCD_S);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA] != lastScheduledByCommandAndRank[Command::WRA][rank.ID()] ? lastScheduledByCommand[Command::WRA] : scMaxTime;
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tBURST + timing.tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXSDLL);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXSDLL);
     }
     else if (command == Command::ACT)
     {
-        lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::ACT, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRC);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::ACT][bankGroup.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRRD_L);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRRD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRRD_S);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRRD_S);
 
-        lastCommandStart = lastScheduledByCommandAndBank[Command::RDA][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::RDA, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tAL + timing.tRTP + timing.tRP);
 
-        lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::WRA, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRPRE + timing.tRP);
 
-        lastCommandStart = lastScheduledByCommandAndBank[Command::PREPB][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::PREPB, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + lastRefreshCycleTime[rank.ID()]);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXS);
 
         if (last4Activates[rank.ID()].size() >= 4)
-            earliestTimeToStart = std::max(earliestTimeToStart, last4Activates[rank.ID()].front() + memSpec->tFAW);
+            earliestTimeToStart = std::max(earliestTimeToStart, last4Activates[rank.ID()].front() + timing.tFAW);
     }
     else if (command == Command::PREPB)
     {
-        lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::ACT, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRAS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRAS);
 
-        lastCommandStart = lastScheduledByCommandAndBank[Command::RD][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::RD, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tAL + timing.tRTP);
 
-        lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
+        lastCommandStart = lastScheduledInBank(Command::WR, bank, payload);
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXP);
     }
     else if (command == Command::PREAB)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRAS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRAS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tAL + timing.tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tAL + timing.tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXP);
     }
     else if (command == Command::REFAB)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tAL + timing.tRTP + timing.tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRPRE + timing.tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + lastRefreshCycleTime[rank.ID()]);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXS);
     }
     else if (command == Command::PDEA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tACTPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tACTPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRAPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRAPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPRPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCKE);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCKE);
     }
     else if (command == Command::PDXA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPD);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tPD);
     }
     else if (command == Command::PDEP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRAPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRAPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPRPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPRPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCKE);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCKE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tREFPDEN);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tREFPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXS);
     }
     else if (command == Command::PDXP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEP][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPD);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tPD);
     }
     else if (command == Command::SREFEN)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + std::max(tRDPDEN, memSpec->tAL + memSpec->tRTP + memSpec->tRP));
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRDASREFEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + std::max(tWRAPDEN, tWRPRE + memSpec->tRP));
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tWRASREFEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + lastRefreshCycleTime[rank.ID()]);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tXS);
     }
     else if (command == Command::SREFEX)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEN][rank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCKESR);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + timing.tCKESR);
     }
     else
         SC_REPORT_FATAL("CheckerDDR4", "Unknown command!");
 
     if (lastCommandOnBus != scMaxTime)
-        earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + memSpec->tCK);
+        earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + timing.tCK);
 
     return earliestTimeToStart;
 }
 
-void CheckerDDR4::insert(Command command, const tlm_generic_payload& payload)
+template <typename Timings>
+void CheckerDDR4<Timings>::insert(Command command, const tlm_generic_payload& payload)
 {
     Rank rank = ControllerExtension::getRank(payload);
     BankGroup bankGroup = ControllerExtension::getBankGroup(payload);
@@ -470,6 +521,8 @@ void CheckerDDR4::insert(Command command, const tlm_generic_payload& payload)
                       + " command is " + command.toString());
 
     lastScheduledByCommandAndBank[command][bank.ID()] = sc_time_stamp();
+    if (subarrayLevelParallelism)
+        lastScheduledByCommandAndSubarray[command][subarrayIndex(bank, payload)] = sc_time_stamp();
     lastScheduledByCommandAndBankGroup[command][bankGroup.ID()] = sc_time_stamp();
     lastScheduledByCommandAndRank[command][rank.ID()] = sc_time_stamp();
     lastScheduledByCommand[command] = sc_time_stamp();
@@ -481,6 +534,95 @@ void CheckerDDR4::insert(Command command, const tlm_generic_payload& payload)
             last4Activates[rank.ID()].pop();
         last4Activates[rank.ID()].push(sc_time_stamp());
     }
+    else if (command == Command::REFAB)
+    {
+        lastRefreshCycleTime[rank.ID()] = memSpec->getExecutionTime(Command::REFAB, payload);
+    }
+}
+
+template <typename Timings>
+const sc_time& CheckerDDR4<Timings>::lastScheduledInBank(Command command, Bank bank, const tlm_generic_payload& payload) const
+{
+    if (subarrayLevelParallelism)
+        return lastScheduledByCommandAndSubarray[command][subarrayIndex(bank, payload)];
+
+    return lastScheduledByCommandAndBank[command][bank.ID()];
+}
+
+template <typename Timings>
+unsigned CheckerDDR4<Timings>::subarrayIndex(Bank bank, const tlm_generic_payload& payload) const
+{
+    return bank.ID() * memSpec->subarraysPerBank + memSpec->getSubarray(ControllerExtension::getRow(payload));
+}
+
+namespace
+{
+
+template <typename Timings>
+bool matchesMemSpec(const MemSpecDDR4& memSpec)
+{
+    const TimingsDDR4 runtime(memSpec);
+    const Timings generated(memSpec);
+    return memSpec.memoryId == Timings::memoryId
+           && runtime.tACTPDEN == generated.tACTPDEN
+           && runtime.tAL == generated.tAL
+           && runtime.tCCD_L == generated.tCCD_L
+           && runtime.tCCD_S == generated.tCCD_S
+           && runtime.tCK == generated.tCK
+           && runtime.tCKE == generated.tCKE
+           && runtime.tCKESR == generated.tCKESR
+           && runtime.tFAW == generated.tFAW
+           && runtime.tPD == generated.tPD
+           && runtime.tPRPDEN == generated.tPRPDEN
+           && runtime.tRAS == generated.tRAS
+           && runtime.tRC == generated.tRC
+           && runtime.tRCD == generated.tRCD
+           && runtime.tREFPDEN == generated.tREFPDEN
+           && runtime.tRFC == generated.tRFC
+           && runtime.tRL == generated.tRL
+           && runtime.tRP == generated.tRP
+           && runtime.tRPRE == generated.tRPRE
+           && runtime.tRRD_L == generated.tRRD_L
+           && runtime.tRRD_S == generated.tRRD_S
+           && runtime.tRTP == generated.tRTP
+           && runtime.tRTRS == generated.tRTRS
+           && runtime.tWL == generated.tWL
+           && runtime.tWPRE == generated.tWPRE
+           && runtime.tWR == generated.tWR
+           && runtime.tWTR_L == generated.tWTR_L
+           && runtime.tWTR_S == generated.tWTR_S
+           && runtime.tXP == generated.tXP
+           && runtime.tXS == generated.tXS
+           && runtime.tXSDLL == generated.tXSDLL
+           && runtime.tBURST == generated.tBURST;
+}
+
+template <typename... GeneratedTimings>
+std::unique_ptr<CheckerIF> createChecker(const Configuration& config, const MemSpecDDR4& memSpec,
+                                         std::tuple<GeneratedTimings...>* /*generatedTimings*/)
+{
+    std::unique_ptr<CheckerIF> checker;
+    ((checker == nullptr && matchesMemSpec<GeneratedTimings>(memSpec)
+          ? void(checker = std::make_unique<CheckerDDR4<GeneratedTimings>>(config))
+          : void()), ...);
+
+    if (checker == nullptr)
+        checker = std::make_unique<CheckerDDR4<TimingsDDR4>>(config);
+    else
+        PRINTDEBUGMESSAGE("CheckerDDR4", "Using generated timings for " + memSpec.memoryId);
+
+    return checker;
+}
+
+} // namespace
+
+std::unique_ptr<CheckerIF> createCheckerDDR4(const Configuration& config)
+{
+    const auto* memSpec = dynamic_cast<const MemSpecDDR4 *>(config.memSpec.get());
+    if (memSpec == nullptr)
+        SC_REPORT_FATAL("CheckerDDR4", "Wrong MemSpec chosen");
+
+    return createChecker(config, *memSpec, static_cast<GeneratedTimingsDDR4*>(nullptr));
 }
 
 } // namespace DRAMSys
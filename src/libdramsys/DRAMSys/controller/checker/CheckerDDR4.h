@@ -36,9 +36,11 @@
 #define CHECKERDDR4_H
 
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/TimingConstant.h"
 #include "DRAMSys/configuration/memspec/MemSpecDDR4.h"
 #include "DRAMSys/configuration/Configuration.h"
 
+#include <memory>
 #include <queue>
 #include <vector>
 #include <unordered_map>
@@ -47,6 +49,61 @@
 namespace DRAMSys
 {
 
+// Timings of the memspec loaded at runtime, the derived constraints are computed once; generated
+// specializations (see cmake/generate_timings.cmake) provide the same members as constexpr values
+struct TimingsDDR4
+{
+    explicit TimingsDDR4(const MemSpecDDR4& memSpec);
+
+    sc_core::sc_time tACTPDEN;
+    sc_core::sc_time tAL;
+    sc_core::sc_time tCCD_L;
+    sc_core::sc_time tCCD_S;
+    sc_core::sc_time tCK;
+    sc_core::sc_time tCKE;
+    sc_core::sc_time tCKESR;
+    sc_core::sc_time tFAW;
+    sc_core::sc_time tPD;
+    sc_core::sc_time tPRPDEN;
+    sc_core::sc_time tRAS;
+    sc_core::sc_time tRC;
+    sc_core::sc_time tRCD;
+    sc_core::sc_time tREFPDEN;
+    sc_core::sc_time tRFC;
+    sc_core::sc_time tRL;
+    sc_core::sc_time tRP;
+    sc_core::sc_time tRPRE;
+    sc_core::sc_time tRRD_L;
+    sc_core::sc_time tRRD_S;
+    sc_core::sc_time tRTP;
+    sc_core::sc_time tRTRS;
+    sc_core::sc_time tWL;
+    sc_core::sc_time tWPRE;
+    sc_core::sc_time tWR;
+    sc_core::sc_time tWTR_L;
+    sc_core::sc_time tWTR_S;
+    sc_core::sc_time tXP;
+    sc_core::sc_time tXS;
+    sc_core::sc_time tXSDLL;
+
+    // Derived constraints
+    sc_core::sc_time tBURST;
+    sc_core::sc_time tRDWR;
+    sc_core::sc_time tRDWR_R;
+    sc_core::sc_time tWRRD_S;
+    sc_core::sc_time tWRRD_L;
+    sc_core::sc_time tWRRD_R;
+    sc_core::sc_time tWRPRE;
+    sc_core::sc_time tRDPDEN;
+    sc_core::sc_time tWRPDEN;
+    sc_core::sc_time tWRAPDEN;
+    sc_core::sc_time tRDASREFEN;
+    sc_core::sc_time tWRASREFEN;
+};
+
+// The timings are a template parameter so that build-time generated specializations with
+// compile-time constants (see DRAMSYS_CONSTEXPR_MEMSPECS) can be used instead of the runtime values
+template <typename Timings>
 class CheckerDDR4 final : public CheckerIF
 {
 public:
@@ -56,8 +113,10 @@ public:
 
 private:
     const MemSpecDDR4 *memSpec;
+    const Timings timing;
 
     std::vector<std::vector<sc_core::sc_time>> lastScheduledByCommandAndBank;
+    std::vector<std::vector<sc_core::sc_time>> lastScheduledByCommandAndSubarray;
     std::vector<std::vector<sc_core::sc_time>> lastScheduledByCommandAndBankGroup;
     std::vector<std::vector<sc_core::sc_time>> lastScheduledByCommandAndRank;
     std::vector<sc_core::sc_time> lastScheduledByCommand;
@@ -66,21 +125,21 @@ private:
     // Four activate window
     std::vector<std::queue<sc_core::sc_time>> last4Activates;
 
+    // Bank-local constraints only apply within one subarray with subarray-level parallelism
+    const bool subarrayLevelParallelism;
+    [[nodiscard]] const sc_core::sc_time& lastScheduledInBank(Command command, Bank bank,
+                                                              const tlm::tlm_generic_payload& payload) const;
+    [[nodiscard]] unsigned subarrayIndex(Bank bank, const tlm::tlm_generic_payload& payload) const;
+
+    // tRFC of the last refresh per rank (differs from tRFC for on-the-fly 1x refreshes)
+    std::vector<sc_core::sc_time> lastRefreshCycleTime;
+
     const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
-    sc_core::sc_time tBURST;
-    sc_core::sc_time tRDWR;
-    sc_core::sc_time tRDWR_R;
-    sc_core::sc_time tWRRD_S;
-    sc_core::sc_time tWRRD_L;
-    sc_core::sc_time tWRRD_R;
-    sc_core::sc_time tRDAACT;
-    sc_core::sc_time tWRPRE;
-    sc_core::sc_time tWRAACT;
-    sc_core::sc_time tRDPDEN;
-    sc_core::sc_time tWRPDEN;
-    sc_core::sc_time tWRAPDEN;
 };
 
+// Returns a generated specialization if one matches the memspec, otherwise the runtime variant
+std::unique_ptr<CheckerIF> createCheckerDDR4(const Configuration& config);
+
 } // namespace DRAMSys
 
 #endif // CHECKERDDR4_H
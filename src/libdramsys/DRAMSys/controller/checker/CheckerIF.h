@@ -37,6 +37,7 @@
 
 #include "DRAMSys/controller/Command.h"
 
+#include <string>
 #include <systemc>
 
 namespace DRAMSys
@@ -49,6 +50,7 @@ public:
 
     virtual sc_core::sc_time timeToSatisfyConstraints(Command command, const tlm::tlm_generic_payload& payload) const = 0;
     virtual void insert(Command command, const tlm::tlm_generic_payload& payload) = 0;
+    virtual void printStatistics(const std::string& /*prefix*/) const {}
 };
 
 } // namespace DRAMSys
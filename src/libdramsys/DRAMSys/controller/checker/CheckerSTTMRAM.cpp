@@ -37,6 +37,7 @@
 #include "DRAMSys/common/DebugManager.h"
 
 #include <algorithm>
+#include <iostream>
 
 using namespace sc_core;
 using namespace tlm;
@@ -44,7 +45,8 @@ using namespace tlm;
 namespace DRAMSys
 {
 
-CheckerSTTMRAM::CheckerSTTMRAM(const Configuration& config)
+CheckerSTTMRAM::CheckerSTTMRAM(const Configuration& config) :
+    writeCancellation(config.writeCancellation), writeRestartPenalty(config.writeRestartPenalty)
 {
     memSpec = dynamic_cast<const MemSpecSTTMRAM *>(config.memSpec.get());
     if (memSpec == nullptr)
@@ -67,6 +69,10 @@ CheckerSTTMRAM::CheckerSTTMRAM(const Configuration& config)
     tRDPDEN = memSpec->tRL + tBURST + memSpec->tCK;
     tWRPDEN = memSpec->tWL + tBURST + memSpec->tWR;
     tWRAPDEN = memSpec->tWL + tBURST + memSpec->tWR + memSpec->tCK;
+    tWRCANCEL = memSpec->tWL + tBURST;
+
+    restartPending = std::vector<bool>(memSpec->banksPerChannel, false);
+    restartEnd = std::vector<sc_time>(memSpec->banksPerChannel, SC_ZERO_TIME);
 }
 
 sc_time CheckerSTTMRAM::timeToSatisfyConstraints(Command command, const tlm_generic_payload& payload) const
@@ -107,7 +113,8 @@ sc_time CheckerSTTMRAM::timeToSatisfyConstraints(Command command, const tlm_gene
         {
             lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
             if (lastCommandStart != scMaxTime)
-                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE - memSpec->tRTP - memSpec->tAL);
+                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart
+                        + writeRecovery(bank, payload, lastCommandStart) - memSpec->tRTP - memSpec->tAL);
         }
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
@@ -198,7 +205,8 @@ sc_time CheckerSTTMRAM::timeToSatisfyConstraints(Command command, const tlm_gene
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart
+                    + writeRecovery(bank, payload, lastCommandStart) + memSpec->tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::PREPB][bank.ID()];
         if (lastCommandStart != scMaxTime)
@@ -235,7 +243,8 @@ sc_time CheckerSTTMRAM::timeToSatisfyConstraints(Command command, const tlm_gene
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
         if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart
+                    + writeRecovery(bank, payload, lastCommandStart));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
         if (lastCommandStart != scMaxTime)
@@ -378,6 +387,19 @@ sc_time CheckerSTTMRAM::timeToSatisfyConstraints(Command command, const tlm_gene
     else
         SC_REPORT_FATAL("CheckerSTTMRAM", "Unknown command!");
 
+    // Restart of a cancelled write
+    if (writeCancellation)
+    {
+        if (command.isBankCommand())
+            earliestTimeToStart = std::max(earliestTimeToStart, restartEnd[bank.ID()]);
+        else if (command.isRankCommand())
+        {
+            for (unsigned bankID = rank.ID() * memSpec->banksPerRank;
+                 bankID < (rank.ID() + 1) * memSpec->banksPerRank; bankID++)
+                earliestTimeToStart = std::max(earliestTimeToStart, restartEnd[bankID]);
+        }
+    }
+
     if (lastCommandOnBus != scMaxTime)
         earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + memSpec->tCK);
 
@@ -392,6 +414,9 @@ void CheckerSTTMRAM::insert(Command command, const tlm_generic_payload& payload)
     PRINTDEBUGMESSAGE("CheckerSTTMRAM", "Changing state on bank " + std::to_string(bank.ID())
                       + " command is " + command.toString());
 
+    if (writeCancellation)
+        trackWriteCancellation(command, payload);
+
     lastScheduledByCommandAndRank[command][rank.ID()] = sc_time_stamp();
     lastScheduledByCommandAndBank[command][bank.ID()] = sc_time_stamp();
     lastScheduledByCommand[command] = sc_time_stamp();
@@ -406,4 +431,80 @@ void CheckerSTTMRAM::insert(Command command, const tlm_generic_payload& payload)
     }
 }
 
+sc_time CheckerSTTMRAM::writeRecovery(Bank bank, const tlm_generic_payload& payload, const sc_time& writeStart) const
+{
+    // A read may cancel the array write of an older write to its bank as soon as the write data
+    // has been transferred, but only if the remaining write time exceeds the restart penalty
+    if (writeCancellation && payload.is_read() && !restartPending[bank.ID()])
+    {
+        sc_time cancelTime = std::max(sc_time_stamp(), writeStart + tWRCANCEL);
+        if (cancelTime + writeRestartPenalty < writeStart + tWRPRE)
+            return tWRCANCEL;
+    }
+    return tWRPRE;
+}
+
+void CheckerSTTMRAM::trackWriteCancellation(Command command, const tlm_generic_payload& payload)
+{
+    Bank bank = ControllerExtension::getBank(payload);
+
+    if (payload.is_read() && !restartPending[bank.ID()])
+    {
+        // Time at which the bank is precharged by this command and the write recovery it cuts short
+        sc_time prechargeTime = scMaxTime;
+        sc_time writeStart = scMaxTime;
+        if (command == Command::PREPB)
+        {
+            prechargeTime = sc_time_stamp();
+            writeStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
+        }
+        else if (command == Command::RDA)
+        {
+            prechargeTime = sc_time_stamp() + memSpec->tAL + memSpec->tRTP;
+            writeStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
+        }
+        else if (command == Command::ACT)
+        {
+            writeStart = lastScheduledByCommandAndBank[Command::WRA][bank.ID()];
+            if (writeStart != scMaxTime && sc_time_stamp() >= memSpec->tRP)
+                prechargeTime = sc_time_stamp() - memSpec->tRP;
+        }
+
+        if (writeStart != scMaxTime && prechargeTime < writeStart + tWRPRE)
+        {
+            cancelledWrites++;
+            savedWriteRecovery += writeStart + tWRPRE - prechargeTime;
+            // An RDA is itself the read that interrupts the write, PREPB and ACT are followed by one
+            if (command == Command::RDA)
+                scheduleWriteRestart(bank, command);
+            else
+                restartPending[bank.ID()] = true;
+        }
+    }
+    else if (restartPending[bank.ID()] && command.isCasCommand())
+    {
+        restartPending[bank.ID()] = false;
+        scheduleWriteRestart(bank, command);
+    }
+}
+
+void CheckerSTTMRAM::scheduleWriteRestart(Bank bank, Command command)
+{
+    // The cancelled write is restarted after the burst of the interrupting CAS command and occupies
+    // the bank for another full write recovery plus the restart penalty
+    sc_time latency = (command == Command::RD || command == Command::RDA) ? memSpec->tRL : memSpec->tWL;
+    restartEnd[bank.ID()] = sc_time_stamp() + latency + tBURST + memSpec->tWR + writeRestartPenalty;
+}
+
+void CheckerSTTMRAM::printStatistics(const std::string& prefix) const
+{
+    if (!writeCancellation)
+        return;
+
+    std::cout << prefix << std::string("  Cancelled writes: ") << cancelledWrites
+              << " | write recovery cut short by " << savedWriteRecovery
+              << ", restarts cost " << (memSpec->tWR + writeRestartPenalty) * static_cast<double>(cancelledWrites)
+              << std::endl;
+}
+
 } // namespace DRAMSys
@@ -40,6 +40,7 @@
 #include "DRAMSys/configuration/Configuration.h"
 
 #include <queue>
+#include <string>
 #include <vector>
 
 namespace DRAMSys
@@ -51,6 +52,7 @@ public:
     explicit CheckerSTTMRAM(const Configuration& config);
     sc_core::sc_time timeToSatisfyConstraints(Command command, const tlm::tlm_generic_payload& payload) const override;
     void insert(Command command, const tlm::tlm_generic_payload& payload) override;
+    void printStatistics(const std::string& prefix) const override;
 
 private:
     const MemSpecSTTMRAM *memSpec;
@@ -73,6 +75,20 @@ private:
     sc_core::sc_time tRDPDEN;
     sc_core::sc_time tWRPDEN;
     sc_core::sc_time tWRAPDEN;
+
+    // Write cancellation: a read to a bank cuts the write recovery of an older write short
+    // (tWRCANCEL instead of tWRPRE); the write is restarted after the read's column command
+    sc_core::sc_time writeRecovery(Bank bank, const tlm::tlm_generic_payload& payload,
+                                   const sc_core::sc_time& writeStart) const;
+    void trackWriteCancellation(Command command, const tlm::tlm_generic_payload& payload);
+    void scheduleWriteRestart(Bank bank, Command command);
+    const bool writeCancellation;
+    const sc_core::sc_time writeRestartPenalty;
+    sc_core::sc_time tWRCANCEL;
+    std::vector<bool> restartPending;
+    std::vector<sc_core::sc_time> restartEnd;
+    uint64_t cancelledWrites = 0;
+    sc_core::sc_time savedWriteRecovery = sc_core::SC_ZERO_TIME;
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef TIMINGCONSTANT_H
+#define TIMINGCONSTANT_H
+
+#include <cstdint>
+#include <systemc>
+
+namespace DRAMSys
+{
+
+// Compile-time timing value in picoseconds for generated timing specializations. All timings of
+// a specialization, including the derived constraints of the checker, are constexpr values of this
+// type and are added to or subtracted from sc_time values as integer immediates. The conversion to
+// sc_time itself cannot be constexpr because sc_time is not a literal type in SystemC 2.3.
+// Requires the default time resolution of 1 ps, a generated specialization is only selected if
+// its values match the loaded memspec.
+struct TimingConstant
+{
+    uint64_t picoseconds;
+
+    static constexpr TimingConstant fromMHz(double frequency)
+    {
+        return {static_cast<uint64_t>(1e6 / frequency + 0.5)};
+    }
+
+    operator sc_core::sc_time() const { return sc_core::sc_time::from_value(picoseconds); }
+};
+
+constexpr TimingConstant operator+(TimingConstant a, TimingConstant b)
+{
+    return {a.picoseconds + b.picoseconds};
+}
+
+constexpr TimingConstant operator-(TimingConstant a, TimingConstant b)
+{
+    return {a.picoseconds - b.picoseconds};
+}
+
+constexpr TimingConstant operator*(TimingConstant a, uint64_t factor)
+{
+    return {a.picoseconds * factor};
+}
+
+constexpr TimingConstant operator*(uint64_t factor, TimingConstant a)
+{
+    return {a.picoseconds * factor};
+}
+
+constexpr TimingConstant max(TimingConstant a, TimingConstant b)
+{
+    return a.picoseconds < b.picoseconds ? b : a;
+}
+
+inline sc_core::sc_time operator+(const sc_core::sc_time& time, TimingConstant constant)
+{
+    return sc_core::sc_time::from_value(time.value() + constant.picoseconds);
+}
+
+inline sc_core::sc_time operator-(const sc_core::sc_time& time, TimingConstant constant)
+{
+    return sc_core::sc_time::from_value(time.value() - constant.picoseconds);
+}
+
+} // namespace DRAMSys
+
+#endif // TIMINGCONSTANT_H
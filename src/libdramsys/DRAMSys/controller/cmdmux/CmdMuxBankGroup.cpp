@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "CmdMuxBankGroup.h"
+
+#include "DRAMSys/common/dramExtensions.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <systemc>
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+CmdMuxBankGroup::CmdMuxBankGroup(const Configuration& config) : CmdMuxOldest(config),
+    starvationLimit(config.bankGroupStarvationLimit)
+{
+    if (memSpec.groupsPerRank == 1)
+        SC_REPORT_WARNING("CmdMuxBankGroup", "Selected memory has no bank groups, behavior is equal to \"Oldest\"!");
+
+    alternativeIndices.reserve(memSpec.banksPerChannel);
+}
+
+unsigned CmdMuxBankGroup::replaceCasCommand(const ReadyCommands& readyCommands, unsigned resultCas)
+{
+    // only a column command that is ready now and targets the bank group of the last column command
+    // on the same rank is worth replacing
+    if (std::get<CommandTuple::Timestamp>(readyCommands[resultCas]) != sc_time_stamp())
+        return resultCas;
+
+    const tlm::tlm_generic_payload& oldestTrans = *std::get<CommandTuple::Payload>(readyCommands[resultCas]);
+    if (lastCasTime == scMaxTime
+            || ControllerExtension::getRank(oldestTrans) != lastCasRank
+            || ControllerExtension::getBankGroup(oldestTrans) != lastCasBankGroup)
+    {
+        consecutiveBypasses = 0;
+        return resultCas;
+    }
+
+    if (consecutiveBypasses >= starvationLimit)
+    {
+        starvationOverrides++;
+        consecutiveBypasses = 0;
+        return resultCas;
+    }
+
+    // the alternative is the oldest column command that is ready now and targets another bank group
+    alternativeIndices.clear();
+    for (unsigned i = 0; i < readyCommands.size(); i++)
+    {
+        const CommandTuple::Type& commandTuple = readyCommands[i];
+        if (std::get<CommandTuple::Command>(commandTuple).isCasCommand()
+                && std::get<CommandTuple::Timestamp>(commandTuple) == sc_time_stamp()
+                && ControllerExtension::getBankGroup(*std::get<CommandTuple::Payload>(commandTuple))
+                        != lastCasBankGroup)
+            alternativeIndices.push_back(i);
+    }
+
+    unsigned alternative = selectMinimumKey(alternativeIndices.data(),
+                                            static_cast<unsigned>(alternativeIndices.size()));
+
+    if (alternative >= readyCommands.size())
+    {
+        consecutiveBypasses = 0;
+        return resultCas;
+    }
+
+    bankGroupSwitches++;
+    consecutiveBypasses++;
+    return alternative;
+}
+
+void CmdMuxBankGroup::commandIssued(const CommandTuple::Type& commandTuple)
+{
+    if (!std::get<CommandTuple::Command>(commandTuple).isCasCommand())
+        return;
+
+    const tlm::tlm_generic_payload& trans = *std::get<CommandTuple::Payload>(commandTuple);
+    Rank rank = ControllerExtension::getRank(trans);
+    BankGroup bankGroup = ControllerExtension::getBankGroup(trans);
+
+    // spacing between column commands to different ranks is determined by tRTRS, not by tCCD
+    if (lastCasTime != scMaxTime && rank == lastCasRank)
+    {
+        auto cycles = static_cast<uint64_t>(std::round((sc_time_stamp() - lastCasTime) / memSpec.tCK));
+        if (bankGroup == lastCasBankGroup)
+        {
+            casToCasSameGroup++;
+            cyclesSameGroup += cycles;
+        }
+        else
+        {
+            casToCasDifferentGroup++;
+            cyclesDifferentGroup += cycles;
+        }
+    }
+
+    lastCasRank = rank;
+    lastCasBankGroup = bankGroup;
+    lastCasTime = sc_time_stamp();
+}
+
+void CmdMuxBankGroup::printStatistics(const std::string& prefix) const
+{
+    auto average = [](uint64_t cycles, uint64_t count)
+    {
+        return count == 0 ? 0.0 : static_cast<double>(cycles) / static_cast<double>(count);
+    };
+
+    std::cout << prefix << std::string("  CAS-CAS tCCD_S: ")
+              << std::setw(10) << casToCasDifferentGroup << " | AVG "
+              << std::fixed << std::setprecision(2)
+              << std::setw(6) << average(cyclesDifferentGroup, casToCasDifferentGroup) << " cycles"
+              << std::endl;
+    std::cout << prefix << std::string("  CAS-CAS tCCD_L: ")
+              << std::setw(10) << casToCasSameGroup << " | AVG "
+              << std::fixed << std::setprecision(2)
+              << std::setw(6) << average(cyclesSameGroup, casToCasSameGroup) << " cycles"
+              << std::endl;
+    std::cout << prefix << std::string("  BG switches:    ")
+              << std::setw(10) << bankGroupSwitches << " | starvation overrides: "
+              << starvationOverrides
+              << std::endl;
+}
+
+
+CmdMuxBankGroupRasCas::CmdMuxBankGroupRasCas(const Configuration& config) : CmdMuxBankGroup(config)
+{}
+
+CommandTuple::Type CmdMuxBankGroupRasCas::selectCommand(const ReadyCommands &readyCommands)
+{
+    return issueCommand(readyCommands, selectOldestRasCas(readyCommands));
+}
+
+} // namespace DRAMSys
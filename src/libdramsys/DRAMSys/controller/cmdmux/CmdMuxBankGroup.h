@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef CMDMUXBANKGROUP_H
+#define CMDMUXBANKGROUP_H
+
+#include "DRAMSys/controller/cmdmux/CmdMuxOldest.h"
+
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Based on "Oldest", but among the read and write commands that are ready in the current cycle
+// one to a different bank group than the last issued read or write command is preferred, so
+// that consecutive column commands are separated by tCCD_S instead of tCCD_L. The oldest
+// command can be bypassed at most bankGroupStarvationLimit times in a row.
+// The preference is not applied in the schedulers because they select requests per bank, only
+// the multiplexer sees the candidates of all bank groups.
+class CmdMuxBankGroup : public CmdMuxOldest
+{
+public:
+    explicit CmdMuxBankGroup(const Configuration& config);
+    void printStatistics(const std::string& prefix) const override;
+
+protected:
+    unsigned replaceCasCommand(const ReadyCommands& readyCommands, unsigned resultCas) override;
+    void commandIssued(const CommandTuple::Type& commandTuple) override;
+
+private:
+    const unsigned starvationLimit;
+    unsigned consecutiveBypasses = 0;
+    std::vector<unsigned> alternativeIndices;
+
+    Rank lastCasRank = Rank(0);
+    BankGroup lastCasBankGroup = BankGroup(0);
+    sc_core::sc_time lastCasTime = sc_core::sc_max_time();
+
+    uint64_t bankGroupSwitches = 0;
+    uint64_t starvationOverrides = 0;
+    uint64_t casToCasSameGroup = 0;
+    uint64_t casToCasDifferentGroup = 0;
+    uint64_t cyclesSameGroup = 0;
+    uint64_t cyclesDifferentGroup = 0;
+};
+
+
+class CmdMuxBankGroupRasCas final : public CmdMuxBankGroup
+{
+public:
+    explicit CmdMuxBankGroupRasCas(const Configuration& config);
+    CommandTuple::Type selectCommand(const ReadyCommands &) override;
+};
+
+} // namespace DRAMSys
+
+#endif // CMDMUXBANKGROUP_H
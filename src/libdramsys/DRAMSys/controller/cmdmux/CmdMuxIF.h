@@ -37,6 +37,8 @@
 
 #include "DRAMSys/controller/Command.h"
 
+#include <string>
+
 namespace DRAMSys
 {
 
@@ -45,6 +47,7 @@ class CmdMuxIF
 public:
     virtual ~CmdMuxIF() = default;
     virtual CommandTuple::Type selectCommand(const ReadyCommands &) = 0;
+    virtual void printStatistics(const std::string& /*prefix*/) const {}
 };
 
 } // namespace DRAMSys
@@ -34,6 +34,7 @@
 
 #include "CmdMuxOldest.h"
 
+#include <climits>
 #include <systemc>
 
 using namespace sc_core;
@@ -41,146 +42,154 @@ using namespace sc_core;
 namespace DRAMSys
 {
 
-CmdMuxOldest::CmdMuxOldest(const Configuration& config) : memSpec(*config.memSpec) {}
+// Returns the index of the smallest key (time, payload ID, index) among the given indices or
+// UINT_MAX if no key is smaller than (maxTime, UINT64_MAX). Including the index in the key makes
+// the result independent of the iteration order, so it matches a sequential scan that only
+// replaces its candidate on a strictly smaller (time, payload ID).
+static unsigned reduceMinimumKey(const uint64_t* times, const uint64_t* payloadIDs,
+                                 const unsigned* indices, unsigned numberOfIndices, uint64_t maxTime)
+{
+    uint64_t bestTime = maxTime;
+    uint64_t bestPayloadID = UINT64_MAX;
+    uint64_t bestIndex = UINT_MAX;
 
-CommandTuple::Type CmdMuxOldest::selectCommand(const ReadyCommands &readyCommands)
-{    
-    auto result = readyCommands.cend();
-    uint64_t lastPayloadID = UINT64_MAX;
-    uint64_t newPayloadID;
-    sc_time lastTimestamp = scMaxTime;
-    sc_time newTimestamp;
-
-    for (auto it = readyCommands.cbegin(); it != readyCommands.cend(); it++)
+    for (unsigned i = 0; i < numberOfIndices; i++)
     {
-        newTimestamp = std::get<CommandTuple::Timestamp>(*it) +
-                memSpec.getCommandLength(std::get<CommandTuple::Command>(*it));
-        newPayloadID = ControllerExtension::getChannelPayloadID(*std::get<CommandTuple::Payload>(*it));
+        uint64_t index = indices[i];
+        uint64_t time = times[index];
+        uint64_t payloadID = payloadIDs[index];
 
-        if (newTimestamp < lastTimestamp)
-        {
-            lastTimestamp = newTimestamp;
-            lastPayloadID = newPayloadID;
-            result = it;
-        }
-        else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
-        {
-            lastPayloadID = newPayloadID;
-            result = it;
-        }
+        bool isSmaller = (time < bestTime) | ((time == bestTime)
+                & ((payloadID < bestPayloadID) | ((payloadID == bestPayloadID) & (index < bestIndex))));
+        uint64_t mask = UINT64_C(0) - static_cast<uint64_t>(isSmaller);
+
+        bestTime = (time & mask) | (bestTime & ~mask);
+        bestPayloadID = (payloadID & mask) | (bestPayloadID & ~mask);
+        bestIndex = (index & mask) | (bestIndex & ~mask);
     }
 
-    if (result != readyCommands.cend() &&
-            std::get<CommandTuple::Timestamp>(*result) == sc_time_stamp())
-        return *result;
-    else
-        return {Command::NOP, nullptr, scMaxTime};
+    return static_cast<unsigned>(bestIndex);
 }
 
+static std::vector<uint64_t> precomputeCommandLengths(const MemSpec& memSpec)
+{
+    std::vector<uint64_t> commandLength(Command::numberOfCommands());
+    for (unsigned command = 0; command < Command::numberOfCommands(); command++)
+        commandLength[command] = memSpec.getCommandLength(static_cast<Command::Type>(command)).value();
+    return commandLength;
+}
 
-CmdMuxOldestRasCas::CmdMuxOldestRasCas(const Configuration& config) : memSpec(*config.memSpec)
+CmdMuxOldest::CmdMuxOldest(const Configuration& config) : memSpec(*config.memSpec),
+    commandLength(precomputeCommandLengths(memSpec))
 {
-    readyRasCommands.reserve(memSpec.banksPerChannel);
-    readyCasCommands.reserve(memSpec.banksPerChannel);
-    readyRasCasCommands.reserve(2);
+    readyTimes.reserve(memSpec.banksPerChannel);
+    readyPayloadIDs.reserve(memSpec.banksPerChannel);
+    indices.reserve(memSpec.banksPerChannel);
 }
 
-CommandTuple::Type CmdMuxOldestRasCas::selectCommand(const ReadyCommands &readyCommands)
+CommandTuple::Type CmdMuxOldest::selectCommand(const ReadyCommands &readyCommands)
 {
-    readyRasCommands.clear();
-    readyCasCommands.clear();
+    return issueCommand(readyCommands, selectOldest(readyCommands));
+}
 
-    for (auto it : readyCommands)
+void CmdMuxOldest::computeKeys(const ReadyCommands& readyCommands)
+{
+    auto numberOfCommands = static_cast<unsigned>(readyCommands.size());
+    readyTimes.resize(numberOfCommands);
+    readyPayloadIDs.resize(numberOfCommands);
+    indices.resize(numberOfCommands);
+
+    for (unsigned i = 0; i < numberOfCommands; i++)
     {
-        if (std::get<CommandTuple::Command>(it).isRasCommand())
-            readyRasCommands.emplace_back(it);
-        else
-            readyCasCommands.emplace_back(it);
+        const CommandTuple::Type& commandTuple = readyCommands[i];
+        readyTimes[i] = std::get<CommandTuple::Timestamp>(commandTuple).value()
+                + commandLength[std::get<CommandTuple::Command>(commandTuple)];
+        readyPayloadIDs[i] = ControllerExtension::getChannelPayloadID(*std::get<CommandTuple::Payload>(commandTuple));
     }
+}
 
-    auto result = readyCommands.cend();
-    auto resultRas = readyRasCommands.cend();
-    auto resultCas = readyCasCommands.cend();
+unsigned CmdMuxOldest::selectMinimumKey(const unsigned* keyIndices, unsigned numberOfIndices) const
+{
+    return reduceMinimumKey(readyTimes.data(), readyPayloadIDs.data(), keyIndices, numberOfIndices,
+                            scMaxTime.value());
+}
 
-    uint64_t lastPayloadID = UINT64_MAX;
-    uint64_t newPayloadID;
-    sc_time lastTimestamp = scMaxTime;
-    sc_time newTimestamp;
+unsigned CmdMuxOldest::selectOldest(const ReadyCommands& readyCommands)
+{
+    computeKeys(readyCommands);
 
-    for (auto it = readyRasCommands.cbegin(); it != readyRasCommands.cend(); it++)
-    {
-        newTimestamp = std::get<CommandTuple::Timestamp>(*it) +
-                memSpec.getCommandLength(std::get<CommandTuple::Command>(*it));
-        newPayloadID = ControllerExtension::getChannelPayloadID(*std::get<CommandTuple::Payload>(*it));
+    auto numberOfCommands = static_cast<unsigned>(readyCommands.size());
+    for (unsigned i = 0; i < numberOfCommands; i++)
+        indices[i] = i;
 
-        if (newTimestamp < lastTimestamp)
-        {
-            lastTimestamp = newTimestamp;
-            lastPayloadID = newPayloadID;
-            resultRas = it;
-        }
-        else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
-        {
-            lastPayloadID = newPayloadID;
-            resultRas = it;
-        }
-    }
+    unsigned result = selectMinimumKey(indices.data(), numberOfCommands);
 
-    lastPayloadID = UINT64_MAX;
-    lastTimestamp = scMaxTime;
+    if (result < numberOfCommands && std::get<CommandTuple::Command>(readyCommands[result]).isCasCommand())
+        result = replaceCasCommand(readyCommands, result);
 
-    for (auto it = readyCasCommands.cbegin(); it != readyCasCommands.cend(); it++)
-    {
-        newTimestamp = std::get<CommandTuple::Timestamp>(*it) +
-                memSpec.getCommandLength(std::get<CommandTuple::Command>(*it));
-        newPayloadID = ControllerExtension::getChannelPayloadID(*std::get<CommandTuple::Payload>(*it));
+    return result;
+}
 
-        if (newTimestamp < lastTimestamp)
-        {
-            lastTimestamp = newTimestamp;
-            lastPayloadID = newPayloadID;
-            resultCas = it;
-        }
-        else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
-        {
-            lastPayloadID = newPayloadID;
-            resultCas = it;
-        }
-    }
+unsigned CmdMuxOldest::selectOldestRasCas(const ReadyCommands& readyCommands)
+{
+    computeKeys(readyCommands);
 
-    readyRasCasCommands.clear();
+    auto numberOfCommands = static_cast<unsigned>(readyCommands.size());
+    unsigned numberOfRasCommands = 0;
+    unsigned firstCasCommand = numberOfCommands;
 
-    if (resultRas != readyRasCommands.cend())
-        readyRasCasCommands.emplace_back(*resultRas);
-    if (resultCas != readyCasCommands.cend())
-        readyRasCasCommands.emplace_back(*resultCas);
+    for (unsigned i = 0; i < numberOfCommands; i++)
+    {
+        if (std::get<CommandTuple::Command>(readyCommands[i]).isRasCommand())
+            indices[numberOfRasCommands++] = i;
+        else
+            indices[--firstCasCommand] = i;
+    }
 
-    lastPayloadID = UINT64_MAX;
-    lastTimestamp = scMaxTime;
+    unsigned resultRas = selectMinimumKey(indices.data(), numberOfRasCommands);
+    unsigned resultCas = selectMinimumKey(indices.data() + firstCasCommand, numberOfCommands - firstCasCommand);
 
-    for (auto it = readyRasCasCommands.cbegin(); it != readyRasCasCommands.cend(); it++)
-    {
-        newTimestamp = std::get<CommandTuple::Timestamp>(*it);
-        newPayloadID = ControllerExtension::getChannelPayloadID(*std::get<CommandTuple::Payload>(*it));
+    if (resultCas < numberOfCommands)
+        resultCas = replaceCasCommand(readyCommands, resultCas);
 
-        if (newTimestamp < lastTimestamp)
-        {
-            lastTimestamp = newTimestamp;
-            lastPayloadID = newPayloadID;
-            result = it;
-        }
-        else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
+    // RAS and CAS candidates are compared by the time they can be issued (without command length),
+    // the RAS candidate wins ties of both time and payload ID
+    unsigned result = resultRas;
+    if (resultCas < numberOfCommands)
+    {
+        if (resultRas >= numberOfCommands)
+            result = resultCas;
+        else
         {
-            lastPayloadID = newPayloadID;
-            result = it;
+            const sc_time& timeRas = std::get<CommandTuple::Timestamp>(readyCommands[resultRas]);
+            const sc_time& timeCas = std::get<CommandTuple::Timestamp>(readyCommands[resultCas]);
+            if (timeCas < timeRas || (timeCas == timeRas && readyPayloadIDs[resultCas] < readyPayloadIDs[resultRas]))
+                result = resultCas;
         }
     }
 
-    if (result != readyCommands.cend() &&
-            std::get<CommandTuple::Timestamp>(*result) == sc_time_stamp())
-        return *result;
+    return result;
+}
+
+CommandTuple::Type CmdMuxOldest::issueCommand(const ReadyCommands& readyCommands, unsigned result)
+{
+    if (result < readyCommands.size() &&
+            std::get<CommandTuple::Timestamp>(readyCommands[result]) == sc_time_stamp())
+    {
+        commandIssued(readyCommands[result]);
+        return readyCommands[result];
+    }
     else
         return {Command::NOP, nullptr, scMaxTime};
 }
 
+
+CmdMuxOldestRasCas::CmdMuxOldestRasCas(const Configuration& config) : CmdMuxOldest(config)
+{}
+
+CommandTuple::Type CmdMuxOldestRasCas::selectCommand(const ReadyCommands &readyCommands)
+{
+    return issueCommand(readyCommands, selectOldestRasCas(readyCommands));
+}
+
 } // namespace DRAMSys
@@ -38,33 +38,56 @@
 #include "DRAMSys/controller/cmdmux/CmdMuxIF.h"
 #include "DRAMSys/configuration/Configuration.h"
 
+#include <vector>
+
 namespace DRAMSys
 {
 
+// Ready commands are converted into packed selection keys (time after command length, payload ID)
+// that are reduced without data-dependent branches. The command lengths are precomputed per command.
 class CmdMuxOldest : public CmdMuxIF
 {
 public:
     explicit CmdMuxOldest(const Configuration& config);
     CommandTuple::Type selectCommand(const ReadyCommands &) override;
 
-private:
+protected:
+    // Index of the oldest ready command or UINT_MAX if there is none
+    unsigned selectOldest(const ReadyCommands& readyCommands);
+    // Same as selectOldest, but RAS and CAS commands are selected separately first
+    unsigned selectOldestRasCas(const ReadyCommands& readyCommands);
+    // Returns the command at the given index if it can be issued in the current cycle, otherwise NOP
+    CommandTuple::Type issueCommand(const ReadyCommands& readyCommands, unsigned result);
+
+    // Index of the smallest key among the given indices, the keys are valid after one of the selectOldest calls
+    [[nodiscard]] unsigned selectMinimumKey(const unsigned* keyIndices, unsigned numberOfIndices) const;
+
+    // The oldest CAS command can be replaced before it is compared with the RAS commands
+    virtual unsigned replaceCasCommand(const ReadyCommands& /*readyCommands*/, unsigned resultCas)
+    {
+        return resultCas;
+    }
+    virtual void commandIssued(const CommandTuple::Type& /*commandTuple*/) {}
+
     const MemSpec& memSpec;
     const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
+
+private:
+    void computeKeys(const ReadyCommands& readyCommands);
+
+    std::vector<uint64_t> commandLength;
+    std::vector<uint64_t> readyTimes;
+    std::vector<uint64_t> readyPayloadIDs;
+    // indices of RAS commands are stored from the front, indices of CAS commands from the back
+    std::vector<unsigned> indices;
 };
 
 
-class CmdMuxOldestRasCas : public CmdMuxIF
+class CmdMuxOldestRasCas : public CmdMuxOldest
 {
 public:
     explicit CmdMuxOldestRasCas(const Configuration& config);
     CommandTuple::Type selectCommand(const ReadyCommands &) override;
-
-private:
-    const MemSpec& memSpec;
-    ReadyCommands readyRasCommands;
-    ReadyCommands readyCasCommands;
-    ReadyCommands readyRasCasCommands;
-    const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
 };
 
 } // namespace DRAMSys
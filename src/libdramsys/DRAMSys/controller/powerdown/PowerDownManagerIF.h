@@ -49,6 +49,9 @@ public:
     virtual void triggerEntry() = 0;
     virtual void triggerExit() = 0;
     virtual void triggerInterruption() = 0;
+    // Requests are pending, but the rank stays in its current power-down state until triggerExit()
+    virtual void triggerHold() = 0;
+    [[nodiscard]] virtual bool isInPowerDown() const = 0;
 };
 
 } // namespace DRAMSys
@@ -75,6 +75,19 @@ void PowerDownManagerStaggered::triggerInterruption()
         exitTriggered = true;
 }
 
+void PowerDownManagerStaggered::triggerHold()
+{
+    controllerIdle = false;
+    enterSelfRefresh = false;
+    entryTriggered = false;
+}
+
+bool PowerDownManagerStaggered::isInPowerDown() const
+{
+    return !exitTriggered
+           && (state == State::ActivePdn || state == State::PrechargePdn || state == State::SelfRefresh);
+}
+
 CommandTuple::Type PowerDownManagerStaggered::getNextCommand()
 {
     return {nextCommand, &powerDownPayload, SC_ZERO_TIME};
@@ -55,6 +55,8 @@ public:
     void triggerEntry() override;
     void triggerExit() override;
     void triggerInterruption() override;
+    void triggerHold() override;
+    [[nodiscard]] bool isInPowerDown() const override;
 
     CommandTuple::Type getNextCommand() override;
     void update(Command) override;
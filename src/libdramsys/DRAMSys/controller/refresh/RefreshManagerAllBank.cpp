@@ -38,6 +38,9 @@
 #include "DRAMSys/controller/BankMachine.h"
 #include "DRAMSys/controller/powerdown/PowerDownManagerIF.h"
 
+#include <iomanip>
+#include <iostream>
+
 using namespace sc_core;
 using namespace tlm;
 
@@ -46,24 +49,34 @@ namespace DRAMSys
 
 RefreshManagerAllBank::RefreshManagerAllBank(const Configuration& config, std::vector<BankMachine*>& bankMachinesOnRank,
                                              PowerDownManagerIF& powerDownManager, Rank rank)
-    : bankMachinesOnRank(bankMachinesOnRank), powerDownManager(powerDownManager),
-    memSpec(*config.memSpec), maxPostponed(static_cast<int>(config.refreshMaxPostponed)),
+    : memSpec(*config.memSpec), bankMachinesOnRank(bankMachinesOnRank), powerDownManager(powerDownManager),
+    refreshGranularity(memSpec.getRefreshGranularity()), onTheFlyRefresh(memSpec.hasOnTheFlyRefresh()),
+    maxPostponed(static_cast<int>(config.refreshMaxPostponed)),
     maxPulledin(-static_cast<int>(config.refreshMaxPulledin)), refreshManagement(config.refreshManagement)
 {
     timeForNextTrigger = getTimeForFirstTrigger(memSpec.tCK, memSpec.getRefreshIntervalAB(),
                                                 rank, memSpec.ranksPerChannel);
     setUpDummy(refreshPayload, 0, rank);
+    setUpDummy(coarseRefreshPayload, 0, rank);
+    RefreshModeExtension::setAutoExtension(coarseRefreshPayload, RefreshModeExtension::Mode::Normal);
 }
 
 CommandTuple::Type RefreshManagerAllBank::getNextCommand()
 {
-    return {nextCommand, &refreshPayload, SC_ZERO_TIME};
+    return {nextCommand, nextRefreshPayload, SC_ZERO_TIME};
 }
 
 void RefreshManagerAllBank::evaluate()
 {
     nextCommand = Command::NOP;
 
+    // Skipped refreshes are retired without a command, also during power-down
+    while (sc_time_stamp() >= timeForNextTrigger && isRefreshSkippable())
+    {
+        refreshSkipped();
+        completeRefresh();
+    }
+
     if (sc_time_stamp() >= timeForNextTrigger) // Normal refresh
     {
         powerDownManager.triggerInterruption();
@@ -106,6 +119,9 @@ void RefreshManagerAllBank::evaluate()
                 else
                     nextCommand = Command::REFAB;
 
+                // Forced refreshes block pending requests, use the shorter fine granularity refresh
+                nextRefreshPayload = (onTheFlyRefresh && flexibilityCounter != maxPostponed)
+                        ? &coarseRefreshPayload : &refreshPayload;
                 return;
             }
         }
@@ -127,6 +143,7 @@ void RefreshManagerAllBank::evaluate()
             {
                 assert(activatedBanks == 0);
                 nextCommand = Command::REFAB;
+                nextRefreshPayload = onTheFlyRefresh ? &coarseRefreshPayload : &refreshPayload;
                 return;
             }
         }
@@ -168,6 +185,8 @@ void RefreshManagerAllBank::evaluate()
             else
                 nextCommand = Command::RFMAB;
 
+            nextRefreshPayload = &refreshPayload;
+
             return;
         }
     }
@@ -193,19 +212,19 @@ void RefreshManagerAllBank::update(Command command)
                 state = State::Regular; // TODO: check if this assignment is necessary
                 timeForNextTrigger = sc_time_stamp() + memSpec.getRefreshIntervalAB();
                 sleeping = false;
+                refreshIntervalCompleted();
+            }
+            else if (nextRefreshPayload == &coarseRefreshPayload)
+            {
+                // A 1x refresh covers the refresh intervals of all fine granularity refreshes it replaces
+                coarseRefreshes++;
+                for (unsigned i = 0; i < refreshGranularity; i++)
+                    completeRefresh();
             }
             else
             {
-                if (state == State::Pulledin)
-                    flexibilityCounter--;
-                else
-                    state = State::Pulledin;
-
-                if (flexibilityCounter == maxPulledin)
-                {
-                    state = State::Regular;
-                    timeForNextTrigger += memSpec.getRefreshIntervalAB();
-                }
+                fineRefreshes++;
+                completeRefresh();
             }
             break;
         case Command::PDEA: case Command::PDEP:
@@ -223,9 +242,44 @@ void RefreshManagerAllBank::update(Command command)
     }
 }
 
+void RefreshManagerAllBank::completeRefresh()
+{
+    refreshIntervalCompleted();
+
+    if (state == State::Pulledin)
+        flexibilityCounter--;
+    else
+        state = State::Pulledin;
+
+    if (flexibilityCounter == maxPulledin)
+    {
+        state = State::Regular;
+        timeForNextTrigger += memSpec.getRefreshIntervalAB();
+    }
+}
+
 sc_time RefreshManagerAllBank::getTimeForNextTrigger()
 {
     return timeForNextTrigger;
 }
 
+void RefreshManagerAllBank::printStatistics(const std::string& prefix) const
+{
+    if (refreshGranularity == 1)
+        return;
+
+    sc_time busyTime = static_cast<double>(fineRefreshes) * memSpec.getExecutionTime(Command::REFAB, refreshPayload);
+    if (onTheFlyRefresh)
+        busyTime += static_cast<double>(coarseRefreshes) * memSpec.getExecutionTime(Command::REFAB, coarseRefreshPayload);
+
+    std::cout << prefix << std::string("  Refresh rank ") << ControllerExtension::getRank(refreshPayload).ID() << ": "
+              << fineRefreshes << " REFAB " << refreshGranularity << "x";
+    if (onTheFlyRefresh)
+        std::cout << ", " << coarseRefreshes << " REFAB 1x (on-the-fly)";
+    std::cout << ", " << busyTime << " rank busy time";
+    if (sc_time_stamp() > SC_ZERO_TIME)
+        std::cout << " (" << std::fixed << std::setprecision(2) << busyTime / sc_time_stamp() * 100.0 << " %)";
+    std::cout << std::endl;
+}
+
 } // namespace DRAMSys
@@ -50,7 +50,7 @@ namespace DRAMSys
 class BankMachine;
 class PowerDownManagerIF;
 
-class RefreshManagerAllBank final : public RefreshManagerIF
+class RefreshManagerAllBank : public RefreshManagerIF
 {
 public:
     RefreshManagerAllBank(const Configuration& config, std::vector<BankMachine*>& bankMachinesOnRank,
@@ -60,13 +60,30 @@ public:
     void evaluate() override;
     void update(Command) override;
     sc_core::sc_time getTimeForNextTrigger() override;
+    void printStatistics(const std::string& prefix) const override;
+
+protected:
+    // Called for every refresh interval that is covered by a refresh command, refresh policies that
+    // track which rows are refreshed (e.g., RefreshManagerRetention) advance their position here
+    virtual void refreshIntervalCompleted() {}
+    // Refresh intervals for which this returns true are retired without a refresh command
+    [[nodiscard]] virtual bool isRefreshSkippable() const { return false; }
+    virtual void refreshSkipped() {}
+
+    const MemSpec& memSpec;
+    tlm::tlm_generic_payload refreshPayload;
 
 private:
     enum class State {Regular, Pulledin} state = State::Regular;
-    const MemSpec& memSpec;
     std::vector<BankMachine*>& bankMachinesOnRank;
     PowerDownManagerIF& powerDownManager;
-    tlm::tlm_generic_payload refreshPayload;
+    // On-the-fly fine granularity refresh: a 1x refresh covers several refresh intervals
+    tlm::tlm_generic_payload coarseRefreshPayload;
+    tlm::tlm_generic_payload* nextRefreshPayload = &refreshPayload;
+    const unsigned refreshGranularity;
+    const bool onTheFlyRefresh;
+    uint64_t fineRefreshes = 0;
+    uint64_t coarseRefreshes = 0;
     sc_core::sc_time timeForNextTrigger = sc_core::sc_max_time();
     Command nextCommand = Command::NOP;
 
@@ -79,6 +96,8 @@ private:
     bool sleeping = false;
     const bool refreshManagement;
     const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
+
+    void completeRefresh();
 };
 
 } // namespace DRAMSys
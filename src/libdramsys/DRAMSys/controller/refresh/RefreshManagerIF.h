@@ -40,6 +40,7 @@
 #include "DRAMSys/configuration/Configuration.h"
 
 #include <cmath>
+#include <string>
 #include <systemc>
 
 namespace DRAMSys
@@ -49,6 +50,7 @@ class RefreshManagerIF : public ManagerIF
 {
 public:
     virtual sc_core::sc_time getTimeForNextTrigger() = 0;
+    virtual void printStatistics(const std::string& /*prefix*/) const {}
 
 protected:
     static sc_core::sc_time getTimeForFirstTrigger(const sc_core::sc_time& tCK, const sc_core::sc_time &refreshInterval,
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "RefreshManagerRetention.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+static unsigned computeSlotsPerWindow(const Configuration& config)
+{
+    // One slot per refresh command in the refresh window, this also accounts for fine granularity refresh
+    auto slots = static_cast<unsigned>(std::lround(config.retentionRefreshWindow
+                                                   / config.memSpec->getRefreshIntervalAB()));
+    if (slots == 0)
+        SC_REPORT_FATAL("RefreshManagerRetention", "Refresh window shorter than the refresh interval");
+    return std::max(slots, 1U);
+}
+
+RefreshManagerRetention::RefreshManagerRetention(const Configuration& config,
+                                                 std::vector<BankMachine*>& bankMachinesOnRank,
+                                                 PowerDownManagerIF& powerDownManager, Rank rank)
+    : RefreshManagerAllBank(config, bankMachinesOnRank, powerDownManager, rank),
+    slotsPerWindow(computeSlotsPerWindow(config)),
+    rowsPerSlot((memSpec.rowsPerBank + slotsPerWindow - 1) / slotsPerWindow),
+    weakRows(memSpec.banksPerRank, std::vector<bool>(memSpec.rowsPerBank, false)),
+    mediumRows(memSpec.banksPerRank, std::vector<bool>(memSpec.rowsPerBank, false))
+{
+    if (config.retentionProfile.empty())
+        generateProfile(config.retentionSeed + rank.ID());
+    else
+        loadProfile(config.retentionProfile);
+
+    compileSlots();
+}
+
+void RefreshManagerRetention::loadProfile(const std::string& fileName)
+{
+    std::ifstream file(fileName);
+    if (!file)
+        SC_REPORT_FATAL("RefreshManagerRetention", ("Could not open retention profile " + fileName).c_str());
+
+    std::string line;
+    unsigned lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream stream(line);
+        unsigned bank = 0;
+        unsigned row = 0;
+        double retention = 0.0;
+        if (!(stream >> bank >> row >> retention) || bank >= memSpec.banksPerRank || row >= memSpec.rowsPerBank)
+        {
+            SC_REPORT_FATAL("RefreshManagerRetention", ("Invalid entry in " + fileName + " line "
+                    + std::to_string(lineNumber)).c_str());
+        }
+
+        markRow(bank, row, retention);
+    }
+}
+
+void RefreshManagerRetention::generateProfile(uint64_t seed)
+{
+    // Fractions of weak and medium rows as reported for DRAM retention measurements
+    constexpr double weakFraction = 1e-5;
+    constexpr double mediumFraction = 1e-3;
+
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<unsigned> bankDistribution(0, memSpec.banksPerRank - 1);
+    std::uniform_int_distribution<unsigned> rowDistribution(0, memSpec.rowsPerBank - 1);
+    std::uniform_real_distribution<double> weakRetention(64.0, 128.0);
+    std::uniform_real_distribution<double> mediumRetention(128.0, 256.0);
+
+    double totalRows = static_cast<double>(memSpec.banksPerRank) * memSpec.rowsPerBank;
+    auto weakCount = static_cast<uint64_t>(std::ceil(totalRows * weakFraction));
+    auto mediumCount = static_cast<uint64_t>(std::ceil(totalRows * mediumFraction));
+
+    for (uint64_t i = 0; i < weakCount; i++)
+        markRow(bankDistribution(generator), rowDistribution(generator), weakRetention(generator));
+    for (uint64_t i = 0; i < mediumCount; i++)
+        markRow(bankDistribution(generator), rowDistribution(generator), mediumRetention(generator));
+}
+
+void RefreshManagerRetention::markRow(unsigned bank, unsigned row, double retention)
+{
+    if (retention < 128.0)
+        weakRows[bank][row] = true;
+    else if (retention < 256.0)
+        mediumRows[bank][row] = true;
+}
+
+void RefreshManagerRetention::compileSlots()
+{
+    slotPeriod.assign(slotsPerWindow, 2);
+
+    for (unsigned bank = 0; bank < memSpec.banksPerRank; bank++)
+    {
+        for (unsigned row = 0; row < memSpec.rowsPerBank; row++)
+        {
+            uint8_t& period = slotPeriod[row / rowsPerSlot];
+            if (weakRows[bank][row])
+                period = 0;
+            else if (mediumRows[bank][row])
+                period = std::min<uint8_t>(period, 1);
+        }
+    }
+}
+
+bool RefreshManagerRetention::isRefreshSkippable() const
+{
+    uint64_t window = slotCounter / slotsPerWindow;
+    uint8_t period = slotPeriod[slotCounter % slotsPerWindow];
+    return (window & ((uint64_t(1) << period) - 1)) != 0;
+}
+
+void RefreshManagerRetention::refreshIntervalCompleted()
+{
+    // Also called for the refresh after self refresh exit and for every interval of a 1x refresh
+    // in on-the-fly mode, so the slot position always follows the issued refreshes
+    slotCounter++;
+}
+
+void RefreshManagerRetention::refreshSkipped()
+{
+    refreshesSkipped++;
+}
+
+void RefreshManagerRetention::update(Command command)
+{
+    if (command == Command::REFAB)
+        refreshesIssued++;
+
+    RefreshManagerAllBank::update(command);
+}
+
+void RefreshManagerRetention::printStatistics(const std::string& prefix) const
+{
+    RefreshManagerAllBank::printStatistics(prefix);
+
+    sc_time savedTime = static_cast<double>(refreshesSkipped)
+            * memSpec.getExecutionTime(Command::REFAB, refreshPayload);
+    double total = static_cast<double>(refreshesIssued + refreshesSkipped);
+    double savedShare = sc_time_stamp() == SC_ZERO_TIME ? 0.0 : savedTime / sc_time_stamp() * 100.0;
+
+    std::cout << prefix << std::string("  Retention refresh rank ")
+              << ControllerExtension::getRank(refreshPayload).ID() << ": "
+              << refreshesIssued << " issued, " << refreshesSkipped << " saved ("
+              << std::fixed << std::setprecision(2)
+              << (total == 0.0 ? 0.0 : refreshesSkipped / total * 100.0) << " %), "
+              << savedTime << " rank busy time saved (" << savedShare << " %)" << std::endl;
+}
+
+} // namespace DRAMSys
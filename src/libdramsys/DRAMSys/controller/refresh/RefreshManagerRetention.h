@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef REFRESHMANAGERRETENTION_H
+#define REFRESHMANAGERRETENTION_H
+
+#include "DRAMSys/controller/refresh/RefreshManagerAllBank.h"
+#include "DRAMSys/configuration/Configuration.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+class BankMachine;
+class PowerDownManagerIF;
+
+/*
+ * Retention-aware all-bank refresh (RAIDR). The refresh window is divided into one REFAB slot per
+ * all-bank refresh interval, each slot covers a contiguous group of rows in all banks of the rank.
+ * Weak rows (retention < 128 ms) and medium rows (128 ms - 256 ms) are stored as one bitmap per
+ * bank. A slot is refreshed in every window if it contains a weak row, in every second window if it
+ * contains a medium row and in every fourth window otherwise. Skipped slots cost no command, all
+ * other refreshes are issued by RefreshManagerAllBank.
+ */
+class RefreshManagerRetention final : public RefreshManagerAllBank
+{
+public:
+    RefreshManagerRetention(const Configuration& config, std::vector<BankMachine*>& bankMachinesOnRank,
+                            PowerDownManagerIF& powerDownManager, Rank rank);
+
+    void update(Command) override;
+    void printStatistics(const std::string& prefix) const override;
+
+private:
+    void refreshIntervalCompleted() override;
+    [[nodiscard]] bool isRefreshSkippable() const override;
+    void refreshSkipped() override;
+
+    void loadProfile(const std::string& fileName);
+    void generateProfile(uint64_t seed);
+    void markRow(unsigned bank, unsigned row, double retention);
+    void compileSlots();
+
+    const unsigned slotsPerWindow;
+    const unsigned rowsPerSlot;
+    std::vector<std::vector<bool>> weakRows;
+    std::vector<std::vector<bool>> mediumRows;
+    // refresh period of each slot in windows (log2)
+    std::vector<uint8_t> slotPeriod;
+    uint64_t slotCounter = 0;
+
+    uint64_t refreshesIssued = 0;
+    uint64_t refreshesSkipped = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // REFRESHMANAGERRETENTION_H
@@ -47,15 +47,14 @@ BufferCounterBankwise::BufferCounterBankwise(unsigned requestBufferSize, unsigne
     numRequestsOnBank = std::vector<unsigned>(numberOfBanks, 0);
 }
 
-bool BufferCounterBankwise::hasBufferSpace() const
+bool BufferCounterBankwise::hasBufferSpace(Bank bank) const
 {
-    return (numRequestsOnBank[lastBankID] < requestBufferSize);
+    return (numRequestsOnBank[bank.ID()] < requestBufferSize);
 }
 
 void BufferCounterBankwise::storeRequest(const tlm_generic_payload& trans)
 {
-    lastBankID = ControllerExtension::getBank(trans).ID();
-    numRequestsOnBank[lastBankID]++;
+    numRequestsOnBank[ControllerExtension::getBank(trans).ID()]++;
     if (trans.is_read())
         numReadRequests++;
     else
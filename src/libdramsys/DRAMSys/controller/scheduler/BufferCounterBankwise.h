@@ -47,7 +47,7 @@ class BufferCounterBankwise final : public BufferCounterIF
 {
 public:
     BufferCounterBankwise(unsigned requestBufferSize, unsigned numberOfBanks);
-    [[nodiscard]] bool hasBufferSpace() const override;
+    [[nodiscard]] bool hasBufferSpace(Bank bank) const override;
     void storeRequest(const tlm::tlm_generic_payload& trans) override;
     void removeRequest(const tlm::tlm_generic_payload& trans) override;
     [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
@@ -57,7 +57,6 @@ public:
 private:
     const unsigned requestBufferSize;
     std::vector<unsigned> numRequestsOnBank;
-    unsigned lastBankID = 0;
     unsigned numReadRequests = 0;
     unsigned numWriteRequests = 0;
 };
@@ -35,6 +35,8 @@
 #ifndef BUFFERCOUNTERIF_H
 #define BUFFERCOUNTERIF_H
 
+#include "DRAMSys/common/dramExtensions.h"
+
 #include <vector>
 #include <tlm>
 
@@ -45,7 +47,7 @@ class BufferCounterIF
 {
 public:
     virtual ~BufferCounterIF() = default;
-    [[nodiscard]] virtual bool hasBufferSpace() const = 0;
+    [[nodiscard]] virtual bool hasBufferSpace(Bank bank) const = 0;
     virtual void storeRequest(const tlm::tlm_generic_payload& trans) = 0;
     virtual void removeRequest(const tlm::tlm_generic_payload& trans) = 0;
     [[nodiscard]] virtual const std::vector<unsigned>& getBufferDepth() const = 0;
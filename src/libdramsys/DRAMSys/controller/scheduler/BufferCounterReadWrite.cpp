@@ -45,7 +45,7 @@ BufferCounterReadWrite::BufferCounterReadWrite(unsigned requestBufferSize)
     numReadWriteRequests = std::vector<unsigned>(2);
 }
 
-bool BufferCounterReadWrite::hasBufferSpace() const
+bool BufferCounterReadWrite::hasBufferSpace([[maybe_unused]] Bank bank) const
 {
     return (numReadWriteRequests[0] < requestBufferSize && numReadWriteRequests[1] < requestBufferSize);
 }
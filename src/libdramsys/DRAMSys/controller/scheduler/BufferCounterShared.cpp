@@ -45,7 +45,7 @@ BufferCounterShared::BufferCounterShared(unsigned requestBufferSize)
     numRequests = std::vector<unsigned>(1);
 }
 
-bool BufferCounterShared::hasBufferSpace() const
+bool BufferCounterShared::hasBufferSpace([[maybe_unused]] Bank bank) const
 {
     return (numRequests[0] < requestBufferSize);
 }
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "SchedulerEdf.h"
+
+#include "DRAMSys/controller/scheduler/BufferCounterBankwise.h"
+#include "DRAMSys/controller/scheduler/BufferCounterReadWrite.h"
+#include "DRAMSys/controller/scheduler/BufferCounterShared.h"
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+SchedulerEdf::SchedulerEdf(const Configuration& config) : deadlineSlack(config.deadlineSlack)
+{
+    buffer = std::vector<std::list<tlm_generic_payload*>>(config.memSpec->banksPerChannel);
+    deadlines = std::vector<std::multimap<sc_time, tlm_generic_payload*>>(config.memSpec->banksPerChannel);
+
+    if (config.schedulerBuffer == Configuration::SchedulerBuffer::Bankwise)
+        bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize, config.memSpec->banksPerChannel);
+    else if (config.schedulerBuffer == Configuration::SchedulerBuffer::ReadWrite)
+        bufferCounter = std::make_unique<BufferCounterReadWrite>(config.requestBufferSize);
+    else if (config.schedulerBuffer == Configuration::SchedulerBuffer::Shared)
+        bufferCounter = std::make_unique<BufferCounterShared>(config.requestBufferSize);
+}
+
+bool SchedulerEdf::hasBufferSpace(Bank bank) const
+{
+    return bufferCounter->hasBufferSpace(bank);
+}
+
+void SchedulerEdf::storeRequest(tlm_generic_payload& trans)
+{
+    unsigned bankID = ControllerExtension::getBank(trans).ID();
+    buffer[bankID].push_back(&trans);
+
+    sc_time deadline = DeadlineExtension::getDeadline(trans);
+    if (deadline != sc_max_time())
+        deadlines[bankID].emplace(deadline, &trans);
+
+    bufferCounter->storeRequest(trans);
+}
+
+void SchedulerEdf::removeRequest(tlm_generic_payload& trans)
+{
+    bufferCounter->removeRequest(trans);
+    unsigned bankID = ControllerExtension::getBank(trans).ID();
+    for (auto it = buffer[bankID].begin(); it != buffer[bankID].end(); it++)
+    {
+        if (*it == &trans)
+        {
+            buffer[bankID].erase(it);
+            break;
+        }
+    }
+
+    sc_time deadline = DeadlineExtension::getDeadline(trans);
+    if (deadline != sc_max_time())
+    {
+        auto range = deadlines[bankID].equal_range(deadline);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            if (it->second == &trans)
+            {
+                deadlines[bankID].erase(it);
+                break;
+            }
+        }
+    }
+}
+
+tlm_generic_payload* SchedulerEdf::getNextRequest(const BankMachine& bankMachine) const
+{
+    unsigned bankID = bankMachine.getBank().ID();
+    if (!buffer[bankID].empty())
+    {
+        // Earliest deadline first if the slack of the most urgent request is exhausted
+        if (!deadlines[bankID].empty() && deadlines[bankID].begin()->first < sc_time_stamp() + deadlineSlack)
+            return deadlines[bankID].begin()->second;
+
+        if (bankMachine.isActivated())
+        {
+            // Search for row hit
+            for (auto it : buffer[bankID])
+            {
+                if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
+                    return it;
+            }
+        }
+        // No row hit found or bank precharged
+        return buffer[bankID].front();
+    }
+    return nullptr;
+}
+
+bool SchedulerEdf::hasFurtherRowHit(Bank bank, Row row, tlm_command /*command*/) const
+{
+    unsigned rowHitCounter = 0;
+    for (auto it : buffer[bank.ID()])
+    {
+        if (ControllerExtension::getRow(*it) == row)
+        {
+            rowHitCounter++;
+            if (rowHitCounter == 2)
+                return true;
+        }
+    }
+    return false;
+}
+
+bool SchedulerEdf::hasFurtherRequest(Bank bank, tlm_command /*command*/) const
+{
+    return (buffer[bank.ID()].size() >= 2);
+}
+
+const std::vector<unsigned>& SchedulerEdf::getBufferDepth() const
+{
+    return bufferCounter->getBufferDepth();
+}
+
+} // namespace DRAMSys
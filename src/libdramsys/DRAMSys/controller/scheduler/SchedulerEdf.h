@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef SCHEDULEREDF_H
+#define SCHEDULEREDF_H
+
+#include "DRAMSys/controller/scheduler/SchedulerIF.h"
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/controller/BankMachine.h"
+#include "DRAMSys/controller/scheduler/BufferCounterIF.h"
+
+#include <vector>
+#include <list>
+#include <map>
+#include <memory>
+#include <tlm>
+
+namespace DRAMSys
+{
+
+// FR-FCFS with deadline escalation: a request whose deadline is closer than deadlineSlack is
+// served before all row hits of its bank, the most urgent one first
+class SchedulerEdf final : public SchedulerIF
+{
+public:
+    explicit SchedulerEdf(const Configuration& config);
+    [[nodiscard]] bool hasBufferSpace(Bank bank) const override;
+    void storeRequest(tlm::tlm_generic_payload&) override;
+    void removeRequest(tlm::tlm_generic_payload&) override;
+    [[nodiscard]] tlm::tlm_generic_payload* getNextRequest(const BankMachine&) const override;
+    [[nodiscard]] bool hasFurtherRowHit(Bank, Row, tlm::tlm_command) const override;
+    [[nodiscard]] bool hasFurtherRequest(Bank, tlm::tlm_command) const override;
+    [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
+
+private:
+    std::vector<std::list<tlm::tlm_generic_payload*>> buffer;
+    // Requests with a deadline of each bank, ordered by deadline
+    std::vector<std::multimap<sc_core::sc_time, tlm::tlm_generic_payload*>> deadlines;
+    std::unique_ptr<BufferCounterIF> bufferCounter;
+    const sc_core::sc_time deadlineSlack;
+};
+
+} // namespace DRAMSys
+
+#endif // SCHEDULEREDF_H
@@ -55,9 +55,9 @@ SchedulerFifo::SchedulerFifo(const Configuration& config)
         bufferCounter = std::make_unique<BufferCounterShared>(config.requestBufferSize);
 }
 
-bool SchedulerFifo::hasBufferSpace() const
+bool SchedulerFifo::hasBufferSpace(Bank bank) const
 {
-    return bufferCounter->hasBufferSpace();
+    return bufferCounter->hasBufferSpace(bank);
 }
 
 void SchedulerFifo::storeRequest(tlm_generic_payload& payload)
@@ -52,7 +52,7 @@ class SchedulerFifo final : public SchedulerIF
 {
 public:
     explicit SchedulerFifo(const Configuration& config);
-    [[nodiscard]] bool hasBufferSpace() const override;
+    [[nodiscard]] bool hasBufferSpace(Bank bank) const override;
     void storeRequest(tlm::tlm_generic_payload&) override;
     void removeRequest(tlm::tlm_generic_payload&) override;
     [[nodiscard]] tlm::tlm_generic_payload* getNextRequest(const BankMachine&) const override;
@@ -55,9 +55,9 @@ SchedulerFrFcfs::SchedulerFrFcfs(const Configuration& config)
         bufferCounter = std::make_unique<BufferCounterShared>(config.requestBufferSize);
 }
 
-bool SchedulerFrFcfs::hasBufferSpace() const
+bool SchedulerFrFcfs::hasBufferSpace(Bank bank) const
 {
-    return bufferCounter->hasBufferSpace();
+    return bufferCounter->hasBufferSpace(bank);
 }
 
 void SchedulerFrFcfs::storeRequest(tlm_generic_payload& trans)
@@ -88,10 +88,9 @@ tlm_generic_payload* SchedulerFrFcfs::getNextRequest(const BankMachine& bankMach
         if (bankMachine.isActivated())
         {
             // Search for row hit
-            Row openRow = bankMachine.getOpenRow();
             for (auto it : buffer[bankID])
             {
-                if (ControllerExtension::getRow(*it) == openRow)
+                if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
                     return it;
             }
         }
@@ -55,9 +55,9 @@ SchedulerFrFcfsGrp::SchedulerFrFcfsGrp(const Configuration& config)
         bufferCounter = std::make_unique<BufferCounterShared>(config.requestBufferSize);
 }
 
-bool SchedulerFrFcfsGrp::hasBufferSpace() const
+bool SchedulerFrFcfsGrp::hasBufferSpace(Bank bank) const
 {
-    return bufferCounter->hasBufferSpace();
+    return bufferCounter->hasBufferSpace(bank);
 }
 
 void SchedulerFrFcfsGrp::storeRequest(tlm_generic_payload& trans)
@@ -89,11 +89,10 @@ tlm_generic_payload* SchedulerFrFcfsGrp::getNextRequest(const BankMachine& bankM
         if (bankMachine.isActivated())
         {
             // Filter all row hits
-            Row openRow = bankMachine.getOpenRow();
             std::list<tlm_generic_payload *> rowHits;
             for (auto it : buffer[bankID])
             {
-                if (ControllerExtension::getRow(*it) == openRow)
+                if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
                     rowHits.push_back(it);
             }
 
@@ -58,9 +58,9 @@ SchedulerGrpFrFcfs::SchedulerGrpFrFcfs(const Configuration& config)
     SC_REPORT_WARNING("SchedulerGrpFrFcfs", "Hazard detection not yet implemented!");
 }
 
-bool SchedulerGrpFrFcfs::hasBufferSpace() const
+bool SchedulerGrpFrFcfs::hasBufferSpace(Bank bank) const
 {
-    return bufferCounter->hasBufferSpace();
+    return bufferCounter->hasBufferSpace(bank);
 }
 
 void SchedulerGrpFrFcfs::storeRequest(tlm_generic_payload& trans)
@@ -97,10 +97,9 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
             if (bankMachine.isActivated())
             {
                 // Search for read row hit
-                Row openRow = bankMachine.getOpenRow();
                 for (auto it : readBuffer[bankID])
                 {
-                    if (ControllerExtension::getRow(*it) == openRow)
+                    if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
                         return it;
                 }
             }
@@ -112,10 +111,9 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
             if (bankMachine.isActivated())
             {
                 // Search for write row hit
-                Row openRow = bankMachine.getOpenRow();
                 for (auto it : writeBuffer[bankID])
                 {
-                    if (ControllerExtension::getRow(*it) == openRow)
+                    if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
                         return it;
                 }
             }
@@ -132,10 +130,9 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
             if (bankMachine.isActivated())
             {
                 // Search for write row hit
-                Row openRow = bankMachine.getOpenRow();
                 for (auto it : writeBuffer[bankID])
                 {
-                    if (ControllerExtension::getRow(*it) == openRow)
+                    if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
                         return it;
                 }
             }
@@ -147,10 +144,9 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
             if (bankMachine.isActivated())
             {
                 // Search for read row hit
-                Row openRow = bankMachine.getOpenRow();
                 for (auto it : readBuffer[bankID])
                 {
-                    if (ControllerExtension::getRow(*it) == openRow)
+                    if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
                         return it;
                 }
             }
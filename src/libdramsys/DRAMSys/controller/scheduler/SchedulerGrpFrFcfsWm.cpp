@@ -62,9 +62,9 @@ SchedulerGrpFrFcfsWm::SchedulerGrpFrFcfsWm(const Configuration& config)
     SC_REPORT_WARNING("SchedulerGrpFrFcfsWm", "Hazard detection not yet implemented!");
 }
 
-bool SchedulerGrpFrFcfsWm::hasBufferSpace() const
+bool SchedulerGrpFrFcfsWm::hasBufferSpace(Bank bank) const
 {
-    return bufferCounter->hasBufferSpace();
+    return bufferCounter->hasBufferSpace(bank);
 }
 
 void SchedulerGrpFrFcfsWm::storeRequest(tlm_generic_payload& trans)
@@ -101,10 +101,9 @@ tlm_generic_payload* SchedulerGrpFrFcfsWm::getNextRequest(const BankMachine& ban
             if (bankMachine.isActivated())
             {
                 // Search for read row hit
-                Row openRow = bankMachine.getOpenRow();
                 for (auto it : readBuffer[bankID])
                 {
-                    if (ControllerExtension::getRow(*it) == openRow)
+                    if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
                         return it;
                 }
             }
@@ -121,10 +120,9 @@ tlm_generic_payload* SchedulerGrpFrFcfsWm::getNextRequest(const BankMachine& ban
             if (bankMachine.isActivated())
             {
                 // Search for write row hit
-                Row openRow = bankMachine.getOpenRow();
                 for (auto it : writeBuffer[bankID])
                 {
-                    if (ControllerExtension::getRow(*it) == openRow)
+                    if (bankMachine.isRowOpen(ControllerExtension::getRow(*it)))
                         return it;
                 }
             }
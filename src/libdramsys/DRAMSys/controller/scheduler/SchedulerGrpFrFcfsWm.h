@@ -53,7 +53,7 @@ class SchedulerGrpFrFcfsWm final : public SchedulerIF
 {
 public:
     explicit SchedulerGrpFrFcfsWm(const Configuration& config);
-    [[nodiscard]] bool hasBufferSpace() const override;
+    [[nodiscard]] bool hasBufferSpace(Bank bank) const override;
     void storeRequest(tlm::tlm_generic_payload&) override;
     void removeRequest(tlm::tlm_generic_payload&) override;
     [[nodiscard]] tlm::tlm_generic_payload* getNextRequest(const BankMachine&) const override;
@@ -37,6 +37,7 @@
 
 #include "DRAMSys/common/dramExtensions.h"
 
+#include <string>
 #include <vector>
 #include <tlm>
 
@@ -49,13 +50,14 @@ class SchedulerIF
 {
 public:
     virtual ~SchedulerIF() = default;
-    [[nodiscard]] virtual bool hasBufferSpace() const = 0;
+    [[nodiscard]] virtual bool hasBufferSpace(Bank bank) const = 0;
     virtual void storeRequest(tlm::tlm_generic_payload&) = 0;
     virtual void removeRequest(tlm::tlm_generic_payload&) = 0;
     [[nodiscard]] virtual tlm::tlm_generic_payload* getNextRequest(const BankMachine&) const = 0;
     [[nodiscard]] virtual bool hasFurtherRowHit(Bank, Row, tlm::tlm_command) const = 0;
     [[nodiscard]] virtual bool hasFurtherRequest(Bank, tlm::tlm_command) const = 0;
     [[nodiscard]] virtual const std::vector<unsigned>& getBufferDepth() const = 0;
+    virtual void printStatistics(const std::string& /*prefix*/) const {}
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "SchedulerReadPriority.h"
+
+#include "DRAMSys/controller/scheduler/BufferCounterBankwise.h"
+#include "DRAMSys/controller/scheduler/BufferCounterReadWrite.h"
+#include "DRAMSys/controller/scheduler/BufferCounterShared.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+SchedulerReadPriority::SchedulerReadPriority(const Configuration& config) : writeBatchSize(config.writeBatchSize)
+{
+    buffer = std::vector<std::list<Request>>(config.memSpec->banksPerChannel);
+    numWrites = std::vector<unsigned>(config.memSpec->banksPerChannel, 0);
+    writeBatch = std::vector<bool>(config.memSpec->banksPerChannel, false);
+    writesInBatch = std::vector<unsigned>(config.memSpec->banksPerChannel, 0);
+
+    if (config.schedulerBuffer == Configuration::SchedulerBuffer::Bankwise)
+        bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize, config.memSpec->banksPerChannel);
+    else if (config.schedulerBuffer == Configuration::SchedulerBuffer::ReadWrite)
+        bufferCounter = std::make_unique<BufferCounterReadWrite>(config.requestBufferSize);
+    else if (config.schedulerBuffer == Configuration::SchedulerBuffer::Shared)
+        bufferCounter = std::make_unique<BufferCounterShared>(config.requestBufferSize);
+}
+
+bool SchedulerReadPriority::hasBufferSpace(Bank bank) const
+{
+    return bufferCounter->hasBufferSpace(bank);
+}
+
+void SchedulerReadPriority::storeRequest(tlm_generic_payload& trans)
+{
+    unsigned bankID = ControllerExtension::getBank(trans).ID();
+    buffer[bankID].push_back({&trans, sc_time_stamp()});
+    if (trans.is_write())
+        numWrites[bankID]++;
+    updateWriteBatch(bankID);
+
+    bufferCounter->storeRequest(trans);
+}
+
+void SchedulerReadPriority::removeRequest(tlm_generic_payload& trans)
+{
+    bufferCounter->removeRequest(trans);
+    unsigned bankID = ControllerExtension::getBank(trans).ID();
+    for (auto it = buffer[bankID].begin(); it != buffer[bankID].end(); it++)
+    {
+        if (it->payload == &trans)
+        {
+            if (trans.is_write())
+            {
+                servedWrites++;
+                writtenBytes += trans.get_data_length();
+                writeQueueingTime += sc_time_stamp() - it->arrival;
+            }
+            else
+            {
+                servedReads++;
+                readQueueingTime += sc_time_stamp() - it->arrival;
+            }
+            buffer[bankID].erase(it);
+            break;
+        }
+    }
+
+    if (trans.is_write())
+    {
+        numWrites[bankID]--;
+        if (writeBatch[bankID])
+        {
+            writesInBatch[bankID]++;
+            // Give pending reads a chance between two batches
+            if (writesInBatch[bankID] >= writeBatchSize || numWrites[bankID] == 0)
+                writeBatch[bankID] = false;
+            return;
+        }
+    }
+    updateWriteBatch(bankID);
+}
+
+void SchedulerReadPriority::updateWriteBatch(unsigned bankID)
+{
+    if (!writeBatch[bankID] && numWrites[bankID] >= writeBatchSize)
+    {
+        writeBatch[bankID] = true;
+        writesInBatch[bankID] = 0;
+        writeBatches++;
+    }
+}
+
+tlm_generic_payload* SchedulerReadPriority::getNextRequest(const BankMachine& bankMachine) const
+{
+    unsigned bankID = bankMachine.getBank().ID();
+    if (buffer[bankID].empty())
+        return nullptr;
+
+    bool serveWrites = writeBatch[bankID] || numWrites[bankID] == buffer[bankID].size();
+    tlm_command command = serveWrites ? TLM_WRITE_COMMAND : TLM_READ_COMMAND;
+
+    auto selected = buffer[bankID].cend();
+    if (bankMachine.isActivated())
+    {
+        // Search for row hit
+        for (auto it = buffer[bankID].begin(); it != buffer[bankID].end(); it++)
+        {
+            if (it->payload->get_command() == command
+                && bankMachine.isRowOpen(ControllerExtension::getRow(*it->payload)))
+            {
+                selected = it;
+                break;
+            }
+        }
+    }
+    // No row hit found or bank precharged
+    if (selected == buffer[bankID].end())
+    {
+        for (auto it = buffer[bankID].begin(); it != buffer[bankID].end(); it++)
+        {
+            if (it->payload->get_command() == command)
+            {
+                selected = it;
+                break;
+            }
+        }
+    }
+
+    // Neither a read nor a write must overtake an older request of the other type to the same
+    // address, in that case the oldest conflicting request is served first
+    for (auto hazard = oldestHazard(bankID, selected); hazard != selected; hazard = oldestHazard(bankID, selected))
+        selected = hazard;
+
+    return selected->payload;
+}
+
+std::list<SchedulerReadPriority::Request>::const_iterator
+SchedulerReadPriority::oldestHazard(unsigned bankID, std::list<Request>::const_iterator request) const
+{
+    const tlm_generic_payload& trans = *request->payload;
+    for (auto it = buffer[bankID].begin(); it != request; it++)
+    {
+        if (it->payload->get_command() != trans.get_command()
+            && it->payload->get_address() < trans.get_address() + trans.get_data_length()
+            && trans.get_address() < it->payload->get_address() + it->payload->get_data_length())
+            return it;
+    }
+    return request;
+}
+
+bool SchedulerReadPriority::hasFurtherRowHit(Bank bank, Row row, tlm_command /*command*/) const
+{
+    unsigned rowHitCounter = 0;
+    for (const auto& request : buffer[bank.ID()])
+    {
+        if (ControllerExtension::getRow(*request.payload) == row)
+        {
+            rowHitCounter++;
+            if (rowHitCounter == 2)
+                return true;
+        }
+    }
+    return false;
+}
+
+bool SchedulerReadPriority::hasFurtherRequest(Bank bank, tlm_command /*command*/) const
+{
+    return (buffer[bank.ID()].size() >= 2);
+}
+
+const std::vector<unsigned>& SchedulerReadPriority::getBufferDepth() const
+{
+    return bufferCounter->getBufferDepth();
+}
+
+void SchedulerReadPriority::printStatistics(const std::string& prefix) const
+{
+    auto average = [](const sc_time& time, uint64_t count)
+    {
+        return count == 0 ? SC_ZERO_TIME : time / static_cast<double>(count);
+    };
+
+    std::cout << prefix << std::string("  Reads served:   ")
+              << std::setw(10) << servedReads << " | AVG queueing latency "
+              << average(readQueueingTime, servedReads)
+              << std::endl;
+    std::cout << prefix << std::string("  Writes served:  ")
+              << std::setw(10) << servedWrites << " | AVG queueing latency "
+              << average(writeQueueingTime, servedWrites)
+              << ", " << writeBatches << " batches";
+    if (sc_time_stamp() > SC_ZERO_TIME)
+    {
+        std::cout << ", write throughput " << std::fixed << std::setprecision(2)
+                  << static_cast<double>(writtenBytes) / sc_time_stamp().to_seconds() / 1e9 << " GB/s";
+    }
+    std::cout << std::endl;
+}
+
+} // namespace DRAMSys
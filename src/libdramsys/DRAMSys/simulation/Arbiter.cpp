@@ -42,6 +42,7 @@
 #include "DRAMSys/simulation/AddressDecoder.h"
 #include "DRAMSys/configuration/Configuration.h"
 #include "DRAMSys/common/DebugManager.h"
+#include "DRAMSys/common/EventLog.h"
 
 #include "DRAMSys/config/DRAMSysConfiguration.h"
 
@@ -148,6 +149,15 @@ tlm_sync_enum Arbiter::nb_transport_fw(int id, tlm_generic_payload& trans,
         assert(addressDecoder.decodeChannel(adjustedAddress + trans.get_data_length() - 1) == channel);
         ArbiterExtension::setAutoExtension(trans, Thread(id), Channel(channel));
         trans.acquire();
+
+        LOGEVENT(eventLog, eventLogOrigin, EventLog::Event::ArbiterBeginReq, id, channel, adjustedAddress);
+        if (probeBus != nullptr && probeBus->isSubscribed(ProbeEvent::Type::RequestAccepted))
+        {
+            ProbeEvent event(ProbeEvent::Type::RequestAccepted, this, sc_time_stamp() + fwDelay, trans);
+            event.thread = static_cast<unsigned>(id);
+            event.channel = channel;
+            probeBus->publish(event);
+        }
     }
 
     PRINTDEBUGMESSAGE(name(), "[fw] " + getPhaseName(phase) + " notification in " +
@@ -159,6 +169,19 @@ tlm_sync_enum Arbiter::nb_transport_fw(int id, tlm_generic_payload& trans,
 tlm_sync_enum Arbiter::nb_transport_bw(int, tlm_generic_payload& payload,
                               tlm_phase& phase, sc_time& bwDelay)
 {
+    if (phase == BEGIN_RESP)
+    {
+        LOGEVENT(eventLog, eventLogOrigin, EventLog::Event::ArbiterBeginResp, ArbiterExtension::getThread(payload).ID(),
+                 ArbiterExtension::getChannel(payload).ID(), ArbiterExtension::getThreadPayloadID(payload));
+        if (probeBus != nullptr && probeBus->isSubscribed(ProbeEvent::Type::ResponseSent))
+        {
+            ProbeEvent event(ProbeEvent::Type::ResponseSent, this, sc_time_stamp() + bwDelay, payload);
+            event.thread = ArbiterExtension::getThread(payload).ID();
+            event.channel = ArbiterExtension::getChannel(payload).ID();
+            probeBus->publish(event);
+        }
+    }
+
     PRINTDEBUGMESSAGE(name(), "[bw] " + getPhaseName(phase) + " notification in " +
                       bwDelay.to_string());
     payloadEventQueue.notify(payload, phase, bwDelay);
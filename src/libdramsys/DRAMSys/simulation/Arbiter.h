@@ -42,6 +42,8 @@
 
 #include "DRAMSys/simulation/AddressDecoder.h"
 #include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/common/EventLog.h"
+#include "DRAMSys/common/ProbeBus.h"
 
 #include <iostream>
 #include <vector>
@@ -65,6 +67,13 @@ public:
     tlm_utils::multi_passthrough_initiator_socket<Arbiter> iSocket;
     tlm_utils::multi_passthrough_target_socket<Arbiter> tSocket;
 
+    void setProbeBus(ProbeBus& bus) { probeBus = &bus; }
+    void setEventLog(EventLog& log)
+    {
+        eventLog = &log;
+        eventLogOrigin = log.registerOrigin(name());
+    }
+
 protected:
     Arbiter(const sc_core::sc_module_name& name, const Configuration& config,
             const AddressDecoder& addressDecoder);
@@ -98,6 +107,10 @@ protected:
 
     const unsigned bytesPerBeat;
     const uint64_t addressOffset;
+
+    ProbeBus* probeBus = nullptr;
+    EventLog* eventLog = nullptr;
+    uint32_t eventLogOrigin = 0;
 };
 
 class ArbiterSimple final : public Arbiter
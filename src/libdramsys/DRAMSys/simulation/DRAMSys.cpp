@@ -41,28 +41,10 @@
 #include "DRAMSys.h"
 
 #include "DRAMSys/common/DebugManager.h"
+#include "DRAMSys/common/EventLog.h"
 #include "DRAMSys/common/utils.h"
 #include "DRAMSys/controller/Controller.h"
-#include "DRAMSys/simulation/dram/DramDDR3.h"
-#include "DRAMSys/simulation/dram/DramDDR4.h"
-#include "DRAMSys/simulation/dram/DramWideIO.h"
-#include "DRAMSys/simulation/dram/DramLPDDR4.h"
-#include "DRAMSys/simulation/dram/DramWideIO2.h"
-#include "DRAMSys/simulation/dram/DramHBM2.h"
-#include "DRAMSys/simulation/dram/DramGDDR5.h"
-#include "DRAMSys/simulation/dram/DramGDDR5X.h"
-#include "DRAMSys/simulation/dram/DramGDDR6.h"
-#include "DRAMSys/simulation/dram/DramSTTMRAM.h"
-
-#ifdef DDR5_SIM
-#include "DRAMSys/simulation/dram/DramDDR5.h"
-#endif
-#ifdef LPDDR5_SIM
-#include "DRAMSys/simulation/dram/DramLPDDR5.h"
-#endif
-#ifdef HBM3_SIM
-#include "DRAMSys/simulation/dram/DramHBM3.h"
-#endif
+#include "DRAMSys/simulation/dram/DramFactory.h"
 
 #include <cstdlib>
 #include <iostream>
@@ -94,6 +76,9 @@ DRAMSys::DRAMSys(const sc_core::sc_module_name& name,
     // Setup the debug manager:
     setupDebugManager(config.simulationName);
 
+    // Setup the binary event log (also available in release builds):
+    setupEventLog(config.simulationName);
+
     if (initAndBind)
     {
         // Instantiate all internal DRAMSys modules:
@@ -111,6 +96,10 @@ const Configuration& DRAMSys::getConfig() const
 
 void DRAMSys::end_of_simulation()
 {
+    probeBus.flush();
+    if (powerDownStatistics)
+        powerDownStatistics->printStatistics();
+
     if (config.powerAnalysis)
     {
         for (auto& dram : drams)
@@ -156,6 +145,12 @@ void DRAMSys::setupDebugManager([[maybe_unused]] const std::string& traceName) c
 #endif
 }
 
+void DRAMSys::setupEventLog(const std::string& traceName)
+{
+    if (config.eventLogSize > 0)
+        eventLog = std::make_unique<EventLog>(config.eventLogSize, traceName + "_events.bin");
+}
+
 void DRAMSys::instantiateModules(const ::DRAMSys::Config::AddressMapping& addressMapping)
 {
     addressDecoder = std::make_unique<AddressDecoder>(addressMapping, *config.memSpec);
@@ -170,58 +165,65 @@ void DRAMSys::instantiateModules(const ::DRAMSys::Config::AddressMapping& addres
         arbiter = std::make_unique<ArbiterReorder>("arbiter", config, *addressDecoder);
 
     // Create controllers and DRAMs
-    MemSpec::MemoryType memoryType = config.memSpec->memoryType;
-    for (std::size_t i = 0; i < config.memSpec->numberOfChannels; i++)
+    for (unsigned i = 0; i < config.memSpec->numberOfChannels; i++)
     {
-        controllers.emplace_back(std::make_unique<Controller>(("controller" + std::to_string(i)).c_str(), config,
-                                                              *addressDecoder));
-
-        if (memoryType == MemSpec::MemoryType::DDR3)
-            drams.emplace_back(std::make_unique<DramDDR3>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::DDR4)
-            drams.emplace_back(std::make_unique<DramDDR4>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::WideIO)
-            drams.emplace_back(std::make_unique<DramWideIO>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::LPDDR4)
-            drams.emplace_back(std::make_unique<DramLPDDR4>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::WideIO2)
-            drams.emplace_back(std::make_unique<DramWideIO2>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::HBM2)
-            drams.emplace_back(std::make_unique<DramHBM2>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::GDDR5)
-            drams.emplace_back(std::make_unique<DramGDDR5>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::GDDR5X)
-            drams.emplace_back(std::make_unique<DramGDDR5X>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::GDDR6)
-            drams.emplace_back(std::make_unique<DramGDDR6>(("dram" + std::to_string(i)).c_str(), config));
-        else if (memoryType == MemSpec::MemoryType::STTMRAM)
-            drams.emplace_back(std::make_unique<DramSTTMRAM>(("dram" + std::to_string(i)).c_str(), config));
-#ifdef DDR5_SIM
-        else if (memoryType == MemSpec::MemoryType::DDR5)
-            drams.emplace_back(std::make_unique<DramDDR5>(("dram" + std::to_string(i)).c_str(), config));
-#endif
-#ifdef LPDDR5_SIM
-        else if (memoryType == MemSpec::MemoryType::LPDDR5)
-            drams.emplace_back(std::make_unique<DramLPDDR5>(("dram" + std::to_string(i)).c_str(), config));
-#endif
-#ifdef HBM3_SIM
-        else if (memoryType == MemSpec::MemoryType::HBM3)
-            drams.emplace_back(std::make_unique<DramHBM3>(("dram" + std::to_string(i)).c_str(), config));
-#endif
+        controllers.emplace_back(createController(i));
+        drams.emplace_back(createDram(i));
 
         if (config.checkTLM2Protocol)
-            controllersTlmCheckers.push_back(std::make_unique<tlm_utils::tlm2_base_protocol_checker<>>
-                    (("TlmCheckerController" + std::to_string(i)).c_str()));
+            instantiateTlmChecker("TlmCheckerController" + std::to_string(i));
+    }
+
+    // Statistics that are computed from the events of the modules
+    if (config.powerDownPolicy == Configuration::PowerDownPolicy::Staggered)
+    {
+        std::vector<const sc_core::sc_object*> dramObjects;
+        for (const auto& dram : drams)
+            dramObjects.push_back(dram.get());
+        powerDownStatistics = std::make_unique<PowerDownStatistics>(dramObjects, config.memSpec->ranksPerChannel);
+        probeBus.subscribe(*powerDownStatistics, {ProbeEvent::Type::PowerStateChanged});
     }
 }
 
+std::unique_ptr<ControllerIF> DRAMSys::createController(unsigned channel)
+{
+    return std::make_unique<Controller>(("controller" + std::to_string(channel)).c_str(), config, *addressDecoder);
+}
+
+std::unique_ptr<Dram> DRAMSys::createDram(unsigned channel)
+{
+    std::string name = "dram" + std::to_string(channel);
+    return ::DRAMSys::createDram(config.memSpec->memoryType, [&](auto dramType) -> std::unique_ptr<Dram>
+    {
+        using Type = typename decltype(dramType)::type;
+        return std::make_unique<Type>(name.c_str(), config);
+    });
+}
+
+void DRAMSys::instantiateTlmChecker(const std::string& name)
+{
+    if (config.checkTLM2ProtocolSampling > 0)
+        controllersSampledTlmCheckers.emplace_back(std::make_unique<TlmProtocolChecker>(name.c_str(),
+                                                                                        config.checkTLM2ProtocolSampling));
+    else
+        controllersTlmCheckers.emplace_back(std::make_unique<tlm_utils::tlm2_base_protocol_checker<>>(name.c_str()));
+}
+
 void DRAMSys::bindSockets()
 {
     tSocket.bind(arbiter->tSocket);
+    arbiter->setProbeBus(probeBus);
+    if (eventLog)
+        arbiter->setEventLog(*eventLog);
 
     for (unsigned i = 0; i < config.memSpec->numberOfChannels; i++)
     {
-        if (config.checkTLM2Protocol)
+        if (config.checkTLM2Protocol && config.checkTLM2ProtocolSampling > 0)
+        {
+            arbiter->iSocket.bind(controllersSampledTlmCheckers[i]->target_socket);
+            controllersSampledTlmCheckers[i]->initiator_socket.bind(controllers[i]->tSocket);
+        }
+        else if (config.checkTLM2Protocol)
         {
             arbiter->iSocket.bind(controllersTlmCheckers[i]->target_socket);
             controllersTlmCheckers[i]->initiator_socket.bind(controllers[i]->tSocket);
@@ -231,6 +233,10 @@ void DRAMSys::bindSockets()
             arbiter->iSocket.bind(controllers[i]->tSocket);
         }
         controllers[i]->iSocket.bind(drams[i]->tSocket);
+        controllers[i]->setProbeBus(probeBus);
+        if (eventLog)
+            controllers[i]->setEventLog(*eventLog);
+        drams[i]->setProbeBus(probeBus);
     }
 }
 
@@ -43,8 +43,12 @@
 
 #include "DRAMSys/simulation/dram/Dram.h"
 #include "DRAMSys/simulation/Arbiter.h"
+#include "DRAMSys/simulation/PowerDownStatistics.h"
 #include "DRAMSys/simulation/ReorderBuffer.h"
 #include "DRAMSys/common/tlm2_base_protocol_checker.h"
+#include "DRAMSys/common/TlmProtocolChecker.h"
+#include "DRAMSys/common/EventLog.h"
+#include "DRAMSys/common/ProbeBus.h"
 #include "DRAMSys/controller/ControllerIF.h"
 #include "DRAMSys/simulation/AddressDecoder.h"
 
@@ -73,6 +77,17 @@ public:
     const Configuration& getConfig() const;
     const AddressDecoder &getAddressDecoder() const { return *addressDecoder; }
 
+    // Progress information for the telemetry of the simulator
+    uint64_t getNumberOfBeatsServed(unsigned channel) const { return controllers[channel]->getNumberOfBeatsServed(); }
+    virtual std::size_t getRecorderQueueDepth() const { return 0; }
+    virtual std::vector<std::string> getDatabaseFiles() const { return {}; }
+
+    // Listeners subscribed here receive the events of the arbiter, the controllers and the DRAMs
+    ProbeBus& getProbeBus() { return probeBus; }
+
+    // nullptr if the binary event log is disabled (EventLogSize = 0)
+    EventLog* getEventLog() { return eventLog.get(); }
+
 protected:
     DRAMSys(const sc_core::sc_module_name& name,
             const ::DRAMSys::Config::Configuration& configLib,
@@ -81,9 +96,13 @@ protected:
     void end_of_simulation() override;
 
     Configuration config;
+    ProbeBus probeBus;
+    std::unique_ptr<EventLog> eventLog;
+    std::unique_ptr<PowerDownStatistics> powerDownStatistics;
 
     //TLM 2.0 Protocol Checkers
     std::vector<std::unique_ptr<tlm_utils::tlm2_base_protocol_checker<>>> controllersTlmCheckers;
+    std::vector<std::unique_ptr<TlmProtocolChecker>> controllersSampledTlmCheckers;
 
     // TODO: Each DRAM has a reorder buffer (check this!)
     std::unique_ptr<ReorderBuffer> reorder;
@@ -100,12 +119,19 @@ protected:
     std::unique_ptr<AddressDecoder> addressDecoder;
 
     void report(const std::string& message);
+    void instantiateTlmChecker(const std::string& name);
     void bindSockets();
 
+    // Creates the address decoder, the arbiter, the controllers and the DRAMs and subscribes the
+    // statistics to the probe bus. Subclasses only replace the creation of a controller or DRAM.
+    void instantiateModules(const ::DRAMSys::Config::AddressMapping& addressMapping);
+    virtual std::unique_ptr<ControllerIF> createController(unsigned channel);
+    virtual std::unique_ptr<Dram> createDram(unsigned channel);
+
 private:
     static void logo();
-    void instantiateModules(const ::DRAMSys::Config::AddressMapping& addressMapping);
     void setupDebugManager(const std::string& traceName) const;
+    void setupEventLog(const std::string& traceName);
 };
 
 } // namespace DRAMSys
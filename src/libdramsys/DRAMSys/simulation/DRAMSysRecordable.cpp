@@ -39,26 +39,7 @@
 #include "DRAMSys/controller/ControllerRecordable.h"
 #include "DRAMSys/common/TlmRecorder.h"
 #include "DRAMSys/simulation/dram/DramRecordable.h"
-#include "DRAMSys/simulation/dram/DramDDR3.h"
-#include "DRAMSys/simulation/dram/DramDDR4.h"
-#include "DRAMSys/simulation/dram/DramWideIO.h"
-#include "DRAMSys/simulation/dram/DramLPDDR4.h"
-#include "DRAMSys/simulation/dram/DramWideIO2.h"
-#include "DRAMSys/simulation/dram/DramHBM2.h"
-#include "DRAMSys/simulation/dram/DramGDDR5.h"
-#include "DRAMSys/simulation/dram/DramGDDR5X.h"
-#include "DRAMSys/simulation/dram/DramGDDR6.h"
-#include "DRAMSys/simulation/dram/DramSTTMRAM.h"
-
-#ifdef DDR5_SIM
-#include "DRAMSys/simulation/dram/DramDDR5.h"
-#endif
-#ifdef LPDDR5_SIM
-#include "DRAMSys/simulation/dram/DramLPDDR5.h"
-#endif
-#ifdef HBM3_SIM
-#include "DRAMSys/simulation/dram/DramHBM3.h"
-#endif
+#include "DRAMSys/simulation/dram/DramFactory.h"
 
 #include <memory>
 
@@ -80,24 +61,34 @@ DRAMSysRecordable::DRAMSysRecordable(const sc_core::sc_module_name& name, const
     else
         traceName = config.simulationName;
 
-    instantiateModules(traceName, configLib);
+    // The TLM recorders have to be ready before the controllers and DRAMs are created
+    setupTlmRecorders(traceName, configLib);
+    instantiateModules(configLib.addressmapping);
     bindSockets();
     report(headline);
 }
 
 void DRAMSysRecordable::end_of_simulation()
 {
-    // Report power before TLM recorders are finalized
-    if (config.powerAnalysis)
-    {
-        for (auto& dram: drams)
-            dram->reportPower();
-    }
+    // Windows are closed lazily, so the remaining ones have to be recorded before the TLM recorders are finalized
+    for (auto& controller : controllers)
+        static_cast<ControllerRecordable&>(*controller).closeWindows();
+
+    // Flushes the probe bus and reports the power before the TLM recorders are finalized
+    DRAMSys::end_of_simulation();
 
     for (auto& tlmRecorder: tlmRecorders)
         tlmRecorder.finalize();
 }
 
+std::size_t DRAMSysRecordable::getRecorderQueueDepth() const
+{
+    std::size_t queueDepth = 0;
+    for (const auto& tlmRecorder : tlmRecorders)
+        queueDepth += tlmRecorder.getQueueDepth();
+    return queueDepth;
+}
+
 void DRAMSysRecordable::setupTlmRecorders(const std::string& traceName,
                                           const ::DRAMSys::Config::Configuration& configLib)
 {
@@ -117,87 +108,27 @@ void DRAMSysRecordable::setupTlmRecorders(const std::string& traceName,
         memspec[Config::MemSpec::KEY] = configLib.memspec;
 
         tlmRecorders.emplace_back(recorderName, config, dbName);
+        databaseFiles.push_back(dbName);
         tlmRecorders.back().recordMcConfig(mcconfig.dump());
         tlmRecorders.back().recordMemspec(memspec.dump());
         tlmRecorders.back().recordTraceNames(config.simulationName);
     }
 }
 
-void DRAMSysRecordable::instantiateModules(const std::string& traceName,
-                                           const ::DRAMSys::Config::Configuration& configLib)
+std::unique_ptr<ControllerIF> DRAMSysRecordable::createController(unsigned channel)
 {
-    addressDecoder = std::make_unique<AddressDecoder>(configLib.addressmapping, *config.memSpec);
-    addressDecoder->print();
-
-    // Create and properly initialize TLM recorders.
-    // They need to be ready before creating some modules.
-    setupTlmRecorders(traceName, configLib);
-
-    // Create arbiter
-    if (config.arbiter == Configuration::Arbiter::Simple)
-        arbiter = std::make_unique<ArbiterSimple>("arbiter", config, *addressDecoder);
-    else if (config.arbiter == Configuration::Arbiter::Fifo)
-        arbiter = std::make_unique<ArbiterFifo>("arbiter", config, *addressDecoder);
-    else if (config.arbiter == Configuration::Arbiter::Reorder)
-        arbiter = std::make_unique<ArbiterReorder>("arbiter", config, *addressDecoder);
+    return std::make_unique<ControllerRecordable>(("controller" + std::to_string(channel)).c_str(), config,
+                                                  *addressDecoder, tlmRecorders[channel]);
+}
 
-    // Create controllers and DRAMs
-    MemSpec::MemoryType memoryType = config.memSpec->memoryType;
-    for (std::size_t i = 0; i < config.memSpec->numberOfChannels; i++)
+std::unique_ptr<Dram> DRAMSysRecordable::createDram(unsigned channel)
+{
+    std::string name = "dram" + std::to_string(channel);
+    return ::DRAMSys::createDram(config.memSpec->memoryType, [&](auto dramType) -> std::unique_ptr<Dram>
     {
-        controllers.emplace_back(std::make_unique<ControllerRecordable>(("controller" + std::to_string(i)).c_str(),
-                                                                        config, *addressDecoder, tlmRecorders[i]));
-
-        if (memoryType == MemSpec::MemoryType::DDR3)
-            drams.emplace_back(std::make_unique<DramRecordable<DramDDR3>>(("dram" + std::to_string(i)).c_str(),
-                                                                          config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::DDR4)
-            drams.emplace_back(std::make_unique<DramRecordable<DramDDR4>>(("dram" + std::to_string(i)).c_str(),
-                                                                          config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::WideIO)
-            drams.emplace_back(std::make_unique<DramRecordable<DramWideIO>>(("dram" + std::to_string(i)).c_str(),
-                                                                            config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::LPDDR4)
-            drams.emplace_back(std::make_unique<DramRecordable<DramLPDDR4>>(("dram" + std::to_string(i)).c_str(),
-                                                                            config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::WideIO2)
-            drams.emplace_back(std::make_unique<DramRecordable<DramWideIO2>>(("dram" + std::to_string(i)).c_str(),
-                                                                             config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::HBM2)
-            drams.emplace_back(std::make_unique<DramRecordable<DramHBM2>>(("dram" + std::to_string(i)).c_str(),
-                                                                          config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::GDDR5)
-            drams.emplace_back(std::make_unique<DramRecordable<DramGDDR5>>(("dram" + std::to_string(i)).c_str(),
-                                                                           config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::GDDR5X)
-            drams.emplace_back(std::make_unique<DramRecordable<DramGDDR5X>>(("dram" + std::to_string(i)).c_str(),
-                                                                            config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::GDDR6)
-            drams.emplace_back(std::make_unique<DramRecordable<DramGDDR6>>(("dram" + std::to_string(i)).c_str(),
-                                                                           config, tlmRecorders[i]));
-        else if (memoryType == MemSpec::MemoryType::STTMRAM)
-            drams.emplace_back(std::make_unique<DramRecordable<DramSTTMRAM>>(("dram" + std::to_string(i)).c_str(),
-                                                                             config, tlmRecorders[i]));
-#ifdef DDR5_SIM
-        else if (memoryType == MemSpec::MemoryType::DDR5)
-            drams.emplace_back(std::make_unique<DramRecordable<DramDDR5>>(("dram" + std::to_string(i)).c_str(),
-                                                                          config, tlmRecorders[i]));
-#endif
-#ifdef LPDDR5_SIM
-        else if (memoryType == MemSpec::MemoryType::LPDDR5)
-            drams.emplace_back(std::make_unique<DramRecordable<DramLPDDR5>>(("dram" + std::to_string(i)).c_str(),
-                                                                            config, tlmRecorders[i]));
-#endif
-#ifdef HBM3_SIM
-        else if (memoryType == MemSpec::MemoryType::HBM3)
-            drams.emplace_back(std::make_unique<DramRecordable<DramHBM3>>(("dram" + std::to_string(i)).c_str(),
-                                                                          config, tlmRecorders[i]));
-#endif
-
-        if (config.checkTLM2Protocol)
-            controllersTlmCheckers.emplace_back(std::make_unique<tlm_utils::tlm2_base_protocol_checker<>>
-                                                        (("TLMCheckerController" + std::to_string(i)).c_str()));
-    }
+        using Type = typename decltype(dramType)::type;
+        return std::make_unique<DramRecordable<Type>>(name.c_str(), config, tlmRecorders[channel]);
+    });
 }
 
 } // namespace DRAMSys
@@ -45,22 +45,27 @@
 namespace DRAMSys
 {
 
+// Records the transaction phases and the windowed statistics into one database per channel
 class DRAMSysRecordable : public DRAMSys
 {
 public:
     DRAMSysRecordable(const sc_core::sc_module_name& name, const ::DRAMSys::Config::Configuration& configLib);
 
+    std::size_t getRecorderQueueDepth() const override;
+    std::vector<std::string> getDatabaseFiles() const override { return databaseFiles; }
+
 protected:
     void end_of_simulation() override;
+    std::unique_ptr<ControllerIF> createController(unsigned channel) override;
+    std::unique_ptr<Dram> createDram(unsigned channel) override;
 
 private:
     // Transaction Recorders (one per channel).
     // They generate the output databases.
     std::vector<TlmRecorder> tlmRecorders;
+    std::vector<std::string> databaseFiles;
 
     void setupTlmRecorders(const std::string& traceName, const ::DRAMSys::Config::Configuration& configLib);
-
-    void instantiateModules(const std::string& traceName, const ::DRAMSys::Config::Configuration& configLib);
 };
 
 } // namespace DRAMSys
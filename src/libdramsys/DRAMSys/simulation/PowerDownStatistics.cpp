@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "PowerDownStatistics.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+PowerDownStatistics::PowerDownStatistics(const std::vector<const sc_object*>& drams, unsigned ranksPerChannel)
+    : drams(drams)
+{
+    for (const auto* dram : drams)
+        ranks.emplace(dram, std::vector<Rank>(ranksPerChannel));
+}
+
+void PowerDownStatistics::notify(const std::vector<ProbeEvent>& events)
+{
+    for (const auto& event : events)
+    {
+        auto it = ranks.find(event.origin);
+        if (it == ranks.end() || event.rank >= it->second.size())
+            continue;
+
+        Rank& rank = it->second[event.rank];
+        if (event.powerState != ProbeEvent::PowerState::Active)
+        {
+            rank.entryTime = event.time;
+        }
+        else if (rank.entryTime != sc_max_time())
+        {
+            rank.residency += event.time - rank.entryTime;
+            rank.entryTime = sc_max_time();
+        }
+    }
+}
+
+void PowerDownStatistics::printStatistics() const
+{
+    if (sc_time_stamp() == SC_ZERO_TIME)
+        return;
+
+    for (const auto* dram : drams)
+    {
+        const std::vector<Rank>& dramRanks = ranks.at(dram);
+        for (unsigned rankID = 0; rankID < dramRanks.size(); rankID++)
+        {
+            sc_time residency = dramRanks[rankID].residency;
+            if (dramRanks[rankID].entryTime != sc_max_time())
+                residency += sc_time_stamp() - dramRanks[rankID].entryTime;
+
+            std::cout << dram->name() << std::string("  Power-down rank ") << rankID << ": "
+                      << std::fixed << std::setprecision(2) << residency / sc_time_stamp() * 100.0
+                      << " % residency" << std::endl;
+        }
+    }
+}
+
+} // namespace DRAMSys
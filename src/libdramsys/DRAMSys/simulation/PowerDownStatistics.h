@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef POWERDOWNSTATISTICS_H
+#define POWERDOWNSTATISTICS_H
+
+#include "DRAMSys/common/ProbeBus.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <systemc>
+
+namespace DRAMSys
+{
+
+// Power-down and self-refresh residency of each rank, computed from the power state changes that
+// the DRAMs publish on the probe bus
+class PowerDownStatistics final : public ProbeListener
+{
+public:
+    PowerDownStatistics(const std::vector<const sc_core::sc_object*>& drams, unsigned ranksPerChannel);
+
+    void notify(const std::vector<ProbeEvent>& events) override;
+    void printStatistics() const;
+
+private:
+    struct Rank
+    {
+        sc_core::sc_time entryTime = sc_core::sc_max_time();
+        sc_core::sc_time residency = sc_core::SC_ZERO_TIME;
+    };
+
+    std::vector<const sc_core::sc_object*> drams;
+    std::unordered_map<const sc_core::sc_object*, std::vector<Rank>> ranks;
+};
+
+} // namespace DRAMSys
+
+#endif // POWERDOWNSTATISTICS_H
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "DataBusStatistics.h"
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace DRAMSys
+{
+
+namespace
+{
+
+unsigned popcount(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(value));
+#else
+    value = value - ((value >> 1) & UINT64_C(0x5555555555555555));
+    value = (value & UINT64_C(0x3333333333333333)) + ((value >> 2) & UINT64_C(0x3333333333333333));
+    value = (value + (value >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+    return static_cast<unsigned>((value * UINT64_C(0x0101010101010101)) >> 56);
+#endif
+}
+
+// Number of ones in a ^ b (or in a if b is nullptr), processed in 64-bit words so that the
+// compiler can vectorize the loop
+uint64_t xorPopcount(const unsigned char* a, const unsigned char* b, std::size_t length)
+{
+    uint64_t count = 0;
+    std::size_t index = 0;
+    for (; index + 8 <= length; index += 8)
+    {
+        uint64_t wordA = 0;
+        uint64_t wordB = 0;
+        std::memcpy(&wordA, a + index, 8);
+        if (b != nullptr)
+            std::memcpy(&wordB, b + index, 8);
+        count += popcount(wordA ^ wordB);
+    }
+    for (; index < length; index++)
+        count += popcount(b != nullptr ? a[index] ^ b[index] : a[index]);
+    return count;
+}
+
+} // namespace
+
+DataBusStatistics::DataBusStatistics(unsigned bytesPerBeat, double toggleEnergy, double zeroEnergy)
+    : bytesPerBeat(bytesPerBeat), toggleEnergy(toggleEnergy), zeroEnergy(zeroEnergy)
+{
+    for (auto& encoding : encodings)
+    {
+        encoding.lastBeat = std::vector<unsigned char>(bytesPerBeat, 0);
+        encoding.lastInversion = std::vector<bool>(bytesPerBeat, false);
+    }
+}
+
+void DataBusStatistics::transfer(const unsigned char* data, unsigned length)
+{
+    length -= length % bytesPerBeat;
+    if (length == 0)
+        return;
+
+    beats += length / bytesPerBeat;
+
+    // Without inversion beat i toggles the bits that differ from beat i - 1
+    EncodingStatistics& plain = encodings[Plain];
+    plain.toggles += xorPopcount(plain.lastBeat.data(), data, bytesPerBeat);
+    plain.toggles += xorPopcount(data, data + bytesPerBeat, length - bytesPerBeat);
+    plain.zeros += static_cast<uint64_t>(length) * 8 - xorPopcount(data, nullptr, length);
+    std::memcpy(plain.lastBeat.data(), data + length - bytesPerBeat, bytesPerBeat);
+
+    transferInverted(encodings[DbiAc], data, length, true);
+    transferInverted(encodings[DbiDc], data, length, false);
+}
+
+void DataBusStatistics::transferInverted(EncodingStatistics& statistics, const unsigned char* data,
+                                         unsigned length, bool acMode)
+{
+    // A byte lane is inverted if more than half of its bits would toggle (AC) or be zero (DC),
+    // the active low DBI pin transmits a zero for an inverted lane
+    for (unsigned offset = 0; offset < length; offset += bytesPerBeat)
+    {
+        for (unsigned lane = 0; lane < bytesPerBeat; lane++)
+        {
+            unsigned char byte = data[offset + lane];
+            unsigned criterion = acMode ? popcount(static_cast<unsigned char>(byte ^ statistics.lastBeat[lane]))
+                                        : 8 - popcount(byte);
+            bool inverted = criterion > 4;
+            auto transmitted = static_cast<unsigned char>(inverted ? ~byte : byte);
+
+            statistics.toggles += popcount(static_cast<unsigned char>(transmitted ^ statistics.lastBeat[lane]))
+                                  + (inverted != statistics.lastInversion[lane] ? 1 : 0);
+            statistics.zeros += 8 - popcount(transmitted) + (inverted ? 1 : 0);
+            statistics.lastBeat[lane] = transmitted;
+            statistics.lastInversion[lane] = inverted;
+        }
+    }
+}
+
+void DataBusStatistics::print(const std::string& name) const
+{
+    static const char* const encodingNames[] = {"no DBI:", "DBI-AC:", "DBI-DC:"};
+    const double bitsTransferred = static_cast<double>(beats) * bytesPerBeat * 8;
+
+    std::cout << name << std::string("  Data bus:       ") << beats << " beats" << std::endl;
+    for (unsigned encoding = 0; encoding < NumberOfEncodings; encoding++)
+    {
+        const EncodingStatistics& statistics = encodings[encoding];
+        double energy = static_cast<double>(statistics.toggles) * toggleEnergy
+                        + static_cast<double>(statistics.zeros) * zeroEnergy;
+
+        std::cout << name << std::string("  Data bus ") << std::left << std::setw(7) << encodingNames[encoding]
+                  << std::right << std::fixed << std::setprecision(2) << "  toggle rate "
+                  << (beats == 0 ? 0.0 : static_cast<double>(statistics.toggles) / bitsTransferred * 100.0)
+                  << " %, zeros "
+                  << (beats == 0 ? 0.0 : static_cast<double>(statistics.zeros) / bitsTransferred * 100.0)
+                  << " %, I/O energy " << energy << " pJ" << std::endl;
+    }
+}
+
+} // namespace DRAMSys
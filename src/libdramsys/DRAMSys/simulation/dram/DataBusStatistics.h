@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef DATABUSSTATISTICS_H
+#define DATABUSSTATISTICS_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Counts the bit toggles and transmitted zeros of the data bus of one channel from the burst data
+// (without bus inversion, with AC and with DC data bus inversion per byte lane). Toggles drive the
+// switching energy of the interface, zeros the termination energy of pseudo open drain I/Os.
+class DataBusStatistics
+{
+public:
+    enum Encoding
+    {
+        Plain,
+        DbiAc,
+        DbiDc,
+        NumberOfEncodings
+    };
+
+    DataBusStatistics(unsigned bytesPerBeat, double toggleEnergy, double zeroEnergy);
+
+    // Accounts the consecutive beats of one burst, the first beat follows the last beat of the
+    // previous burst
+    void transfer(const unsigned char* data, unsigned length);
+    void print(const std::string& name) const;
+
+    [[nodiscard]] uint64_t getBeats() const { return beats; }
+    // Toggles and zeros include the DBI pins for the encodings with bus inversion
+    [[nodiscard]] uint64_t getToggles(Encoding encoding) const { return encodings[encoding].toggles; }
+    [[nodiscard]] uint64_t getZeros(Encoding encoding) const { return encodings[encoding].zeros; }
+
+private:
+    struct EncodingStatistics
+    {
+        std::vector<unsigned char> lastBeat;
+        std::vector<bool> lastInversion;
+        uint64_t toggles = 0;
+        uint64_t zeros = 0;
+    };
+
+    void transferInverted(EncodingStatistics& statistics, const unsigned char* data, unsigned length, bool acMode);
+
+    const unsigned bytesPerBeat;
+    const double toggleEnergy;
+    const double zeroEnergy;
+    uint64_t beats = 0;
+    std::array<EncodingStatistics, NumberOfEncodings> encodings;
+};
+
+} // namespace DRAMSys
+
+#endif // DATABUSSTATISTICS_H
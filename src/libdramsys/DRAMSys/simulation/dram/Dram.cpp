@@ -93,6 +93,12 @@ Dram::Dram(const sc_module_name& name, const Configuration& config)
         }
     }
 
+    if (config.dataBusStatistics)
+    {
+        dataBusStatistics = std::make_unique<DataBusStatistics>(memSpec.bytesPerBeat, config.dataBusToggleEnergy,
+                                                                config.dataBusZeroEnergy);
+    }
+
     tSocket.register_nb_transport_fw(this, &Dram::nb_transport_fw);
     tSocket.register_b_transport(this, &Dram::b_transport);
     tSocket.register_transport_dbg(this, &Dram::transport_dbg);
@@ -104,6 +110,12 @@ Dram::~Dram()
         free(memory);
 }
 
+void Dram::end_of_simulation()
+{
+    if (dataBusStatistics)
+        dataBusStatistics->print(name());
+}
+
 void Dram::reportPower()
 {
 #ifdef DRAMPOWER
@@ -139,6 +151,24 @@ tlm_sync_enum Dram::nb_transport_fw(tlm_generic_payload& trans, tlm_phase& phase
     }
 #endif
 
+    if (probeBus != nullptr && probeBus->isSubscribed(ProbeEvent::Type::PowerStateChanged) && phase >= BEGIN_PDNA)
+    {
+        ProbeEvent::PowerState powerState = ProbeEvent::PowerState::Active;
+        if (phase == BEGIN_PDNA)
+            powerState = ProbeEvent::PowerState::ActivePowerDown;
+        else if (phase == BEGIN_PDNP)
+            powerState = ProbeEvent::PowerState::PrechargePowerDown;
+        else if (phase == BEGIN_SREF)
+            powerState = ProbeEvent::PowerState::SelfRefresh;
+
+        ProbeEvent event(ProbeEvent::Type::PowerStateChanged, this, sc_time_stamp() + delay);
+        event.rank = ControllerExtension::getRank(trans).ID();
+        event.bank = ControllerExtension::getBank(trans).ID();
+        event.command = Command(phase);
+        event.powerState = powerState;
+        probeBus->publish(event);
+    }
+
     if (storeMode == Configuration::StoreMode::Store)
     {
         if (phase == BEGIN_RD || phase == BEGIN_RDA)
@@ -151,6 +181,10 @@ tlm_sync_enum Dram::nb_transport_fw(tlm_generic_payload& trans, tlm_phase& phase
             unsigned char* phyAddr = memory + trans.get_address();
             memcpy(phyAddr, trans.get_data_ptr(), trans.get_data_length());
         }
+
+        // Bursts occupy the data bus in the order of their column commands
+        if (dataBusStatistics && (phase == BEGIN_RD || phase == BEGIN_RDA || phase == BEGIN_WR || phase == BEGIN_WRA))
+            dataBusStatistics->transfer(trans.get_data_ptr(), trans.get_data_length());
     }
 
     return TLM_ACCEPTED;
@@ -41,8 +41,10 @@
 #ifndef DRAM_H
 #define DRAM_H
 
+#include "DRAMSys/common/ProbeBus.h"
 #include "DRAMSys/configuration/Configuration.h"
 #include "DRAMSys/configuration/memspec/MemSpec.h"
+#include "DRAMSys/simulation/dram/DataBusStatistics.h"
 
 #include <memory>
 #include <systemc>
@@ -69,6 +71,9 @@ protected:
     unsigned char* memory;
     const bool useMalloc;
 
+    std::unique_ptr<DataBusStatistics> dataBusStatistics;
+    ProbeBus* probeBus = nullptr;
+
 #ifdef DRAMPOWER
     std::unique_ptr<libDRAMPower> DRAMPower;
 #endif
@@ -78,6 +83,8 @@ protected:
     virtual void b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay);
     virtual unsigned int transport_dbg(tlm::tlm_generic_payload& trans);
 
+    void end_of_simulation() override;
+
 public:
     static constexpr std::string_view BLOCKING_WARNING =
         "Use the blocking mode of DRAMSys with caution! "
@@ -85,6 +92,8 @@ public:
 
     tlm_utils::simple_target_socket<Dram> tSocket;
 
+    void setProbeBus(ProbeBus& bus) { probeBus = &bus; }
+
     virtual void reportPower();
     ~Dram() override;
 };
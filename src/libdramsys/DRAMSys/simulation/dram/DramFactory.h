@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef DRAMFACTORY_H
+#define DRAMFACTORY_H
+
+#include "DRAMSys/configuration/memspec/MemSpec.h"
+#include "DRAMSys/simulation/dram/Dram.h"
+#include "DRAMSys/simulation/dram/DramDDR3.h"
+#include "DRAMSys/simulation/dram/DramDDR4.h"
+#include "DRAMSys/simulation/dram/DramWideIO.h"
+#include "DRAMSys/simulation/dram/DramLPDDR4.h"
+#include "DRAMSys/simulation/dram/DramWideIO2.h"
+#include "DRAMSys/simulation/dram/DramHBM2.h"
+#include "DRAMSys/simulation/dram/DramGDDR5.h"
+#include "DRAMSys/simulation/dram/DramGDDR5X.h"
+#include "DRAMSys/simulation/dram/DramGDDR6.h"
+#include "DRAMSys/simulation/dram/DramSTTMRAM.h"
+
+#ifdef DDR5_SIM
+#include "DRAMSys/simulation/dram/DramDDR5.h"
+#endif
+#ifdef LPDDR5_SIM
+#include "DRAMSys/simulation/dram/DramLPDDR5.h"
+#endif
+#ifdef HBM3_SIM
+#include "DRAMSys/simulation/dram/DramHBM3.h"
+#endif
+
+#include <memory>
+#include <systemc>
+
+namespace DRAMSys
+{
+
+template <typename Type>
+struct DramType
+{
+    using type = Type;
+};
+
+// Calls create(DramType<T>()) with the DRAM class T that models the given memory type, so that
+// DRAMSys and DRAMSysRecordable share the selection and only differ in how the DRAM is constructed
+template <typename Create>
+std::unique_ptr<Dram> createDram(MemSpec::MemoryType memoryType, Create&& create)
+{
+    if (memoryType == MemSpec::MemoryType::DDR3)
+        return create(DramType<DramDDR3>());
+    else if (memoryType == MemSpec::MemoryType::DDR4)
+        return create(DramType<DramDDR4>());
+    else if (memoryType == MemSpec::MemoryType::WideIO)
+        return create(DramType<DramWideIO>());
+    else if (memoryType == MemSpec::MemoryType::LPDDR4)
+        return create(DramType<DramLPDDR4>());
+    else if (memoryType == MemSpec::MemoryType::WideIO2)
+        return create(DramType<DramWideIO2>());
+    else if (memoryType == MemSpec::MemoryType::HBM2)
+        return create(DramType<DramHBM2>());
+    else if (memoryType == MemSpec::MemoryType::GDDR5)
+        return create(DramType<DramGDDR5>());
+    else if (memoryType == MemSpec::MemoryType::GDDR5X)
+        return create(DramType<DramGDDR5X>());
+    else if (memoryType == MemSpec::MemoryType::GDDR6)
+        return create(DramType<DramGDDR6>());
+    else if (memoryType == MemSpec::MemoryType::STTMRAM)
+        return create(DramType<DramSTTMRAM>());
+#ifdef DDR5_SIM
+    else if (memoryType == MemSpec::MemoryType::DDR5)
+        return create(DramType<DramDDR5>());
+#endif
+#ifdef LPDDR5_SIM
+    else if (memoryType == MemSpec::MemoryType::LPDDR5)
+        return create(DramType<DramLPDDR5>());
+#endif
+#ifdef HBM3_SIM
+    else if (memoryType == MemSpec::MemoryType::HBM3)
+        return create(DramType<DramHBM3>());
+#endif
+
+    SC_REPORT_FATAL("DRAMSys", "Unsupported memory type");
+    return nullptr;
+}
+
+} // namespace DRAMSys
+
+#endif // DRAMFACTORY_H
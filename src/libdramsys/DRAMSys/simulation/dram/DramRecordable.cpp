@@ -69,19 +69,18 @@ template<typename BaseDram>
 DramRecordable<BaseDram>::DramRecordable(const sc_module_name& name, const Configuration& config,
                                          TlmRecorder& tlmRecorder)
     : BaseDram(name, config), tlmRecorder(tlmRecorder),
-    powerWindowSize(config.memSpec->tCK * config.windowSize)
+    powerWindowSize(config.memSpec->tCK * config.windowSize),
+    powerWindowing(config.powerAnalysis && config.enableWindowing), nextPowerWindowTime(powerWindowSize)
 {
-#ifdef DRAMPOWER
-    // Create a thread that is triggered every $powerWindowSize
-    // to generate a Power over Time plot in the Trace analyzer:
-    if (config.powerAnalysis && config.enableWindowing)
-        SC_THREAD(powerWindow);
-#endif
 }
 
 template<typename BaseDram>
 void DramRecordable<BaseDram>::reportPower()
 {
+#ifdef DRAMPOWER
+    if (powerWindowing)
+        closePowerWindows(sc_time_stamp(), true);
+#endif
     BaseDram::reportPower();
 #ifdef DRAMPOWER
     tlmRecorder.recordPower(sc_time_stamp().to_seconds(),
@@ -94,24 +93,26 @@ template<typename BaseDram>
 tlm_sync_enum DramRecordable<BaseDram>::nb_transport_fw(tlm_generic_payload& trans,
                                           tlm_phase &phase, sc_time &delay)
 {
+#ifdef DRAMPOWER
+    // Windows that ended while no command was issued are closed retroactively,
+    // DRAMPower calculates their energy from the commands it has seen so far
+    if (powerWindowing)
+        closePowerWindows(sc_time_stamp(), false);
+#endif
     tlmRecorder.recordPhase(trans, phase, delay);
     return BaseDram::nb_transport_fw(trans, phase, delay);
 }
 
 #ifdef DRAMPOWER
-// This Thread is only triggered when Power Simulation is enabled.
-// It estimates the current average power which will be stored in the trace database for visualization purposes.
 template<typename BaseDram>
-void DramRecordable<BaseDram>::powerWindow()
+void DramRecordable<BaseDram>::closePowerWindows(const sc_time& until, bool inclusive)
 {
-    int64_t clkCycles = 0;
-
-    while (true)
+    while (nextPowerWindowTime < until || (inclusive && nextPowerWindowTime == until))
     {
-        // At the very beginning (zero clock cycles) the energy is 0, so we wait first
-        sc_module::wait(powerWindowSize);
+        sc_time windowEnd = nextPowerWindowTime;
+        nextPowerWindowTime += powerWindowSize;
 
-        clkCycles = std::lround(sc_time_stamp() / this->memSpec.tCK);
+        int64_t clkCycles = std::lround(windowEnd / this->memSpec.tCK);
 
         this->DRAMPower->calcWindowEnergy(clkCycles);
 
@@ -119,7 +120,7 @@ void DramRecordable<BaseDram>::powerWindow()
         assert(!isEqual(this->DRAMPower->getEnergy().window_energy, 0.0));
 
         // Store the time (in seconds) and the current average power (in mW) into the database
-        tlmRecorder.recordPower(sc_time_stamp().to_seconds(),
+        tlmRecorder.recordPower(windowEnd.to_seconds(),
                                  this->DRAMPower->getPower().window_average_power
                                  * this->memSpec.devicesPerRank);
 
@@ -130,7 +131,6 @@ void DramRecordable<BaseDram>::powerWindow()
         PRINTDEBUGMESSAGE(this->name(), std::string("\tWindow Average Power: \t") + std::to_string(
                               this->DRAMPower->getPower().window_average_power *
                               this->memSpec.devicesPerRank) + std::string("\t[mW]"));
-
     }
 }
 #endif
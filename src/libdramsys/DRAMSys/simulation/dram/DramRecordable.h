@@ -64,7 +64,9 @@ private:
 
     TlmRecorder& tlmRecorder;
 
-    sc_core::sc_time powerWindowSize;
+    const sc_core::sc_time powerWindowSize;
+    const bool powerWindowing;
+    sc_core::sc_time nextPowerWindowTime;
 
     // When working with floats, we have to decide ourselves what is an
     // acceptable definition for "equal". Here the number is compared with a
@@ -75,9 +77,9 @@ private:
     }
 
 #ifdef DRAMPOWER
-    // This Thread is only triggered when Power Simulation is enabled.
-    // It estimates the current average power which will be stored in the trace database for visualization purposes.
-    void powerWindow();
+    // Only used when Power Simulation is enabled. It records the average power of all windows that ended
+    // until the given time into the trace database for visualization purposes.
+    void closePowerWindows(const sc_core::sc_time& until, bool inclusive);
 #endif
 };
 
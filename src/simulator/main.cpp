@@ -35,25 +35,74 @@
 
 #include "simulator/Initiator.h"
 #include "simulator/MemoryManager.h"
+#include "simulator/PageTranslator.h"
+#include "simulator/ResultCache.h"
 #include "simulator/SimpleInitiator.h"
+#include "simulator/Telemetry.h"
+#include "simulator/TieredMemory.h"
 #include "simulator/generator/TrafficGenerator.h"
 #include "simulator/hammer/RowHammer.h"
 #include "simulator/player/StlPlayer.h"
-#include "simulator/util.h"
 
 #include <DRAMSys/simulation/DRAMSysRecordable.h>
 
+#include <DRAMSysVersion.h>
+
 #include <systemc>
 #include <tlm>
 #include <tlm_utils/peq_with_cb_and_phase.h>
 #include <tlm_utils/simple_initiator_socket.h>
 
+#include <csignal>
 #include <filesystem>
 #include <fstream>
 #include <random>
 
 static constexpr std::string_view TRACE_DIRECTORY = "traces";
 
+// Event logs of all memory subsystems, dumped on a fatal error, on a crash and on SIGUSR1
+static std::vector<DRAMSys::EventLog *> eventLogs;
+
+static void dumpEventLogs()
+{
+    for (auto *eventLog : eventLogs)
+        eventLog->dump();
+}
+
+static void eventLogSignalHandler(int signal)
+{
+    dumpEventLogs();
+
+#ifndef _WIN32
+    if (signal == SIGUSR1)
+        return;
+#endif
+
+    // restore the default action and raise the signal again to terminate as without the handler
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+static void installEventLogHandlers()
+{
+    if (eventLogs.empty())
+        return;
+
+    sc_core::sc_report_handler::set_handler(
+        [](const sc_core::sc_report &report, const sc_core::sc_actions &actions)
+        {
+            if (report.get_severity() == sc_core::SC_FATAL)
+                dumpEventLogs();
+            sc_core::sc_report_handler::default_handler(report, actions);
+        });
+
+    std::signal(SIGSEGV, eventLogSignalHandler);
+    std::signal(SIGABRT, eventLogSignalHandler);
+#ifndef _WIN32
+    std::signal(SIGUSR1, eventLogSignalHandler);
+#endif
+}
+
 int sc_main(int argc, char **argv)
 {
     std::filesystem::path resourceDirectory = DRAMSYS_RESOURCE_DIR;
@@ -74,6 +123,66 @@ int sc_main(int argc, char **argv)
     if (!configuration.tracesetup.has_value())
         SC_REPORT_FATAL("Simulator", "No traffic initiators specified");
 
+    // The page translator only knows the frames and the address mapping of the first tier
+    if (configuration.simconfig.PageTranslation.has_value() && configuration.tiers.has_value())
+        SC_REPORT_FATAL("Simulator", "PageTranslation is not supported together with tiers");
+
+    // Optional reuse of the results of an identical earlier simulation
+    std::optional<ResultCache> resultCache;
+    std::string resultCacheKey;
+    if (const auto &cacheDirectory = configuration.simconfig.ResultCache)
+    {
+        nlohmann::json resolvedConfiguration = configuration;
+
+        // Settings that do not influence the results
+        resolvedConfiguration["simconfig"].erase("ResultCache");
+        resolvedConfiguration["simconfig"].erase("SimulationProgressBar");
+        resolvedConfiguration["simconfig"].erase("TelemetryInterval");
+
+        // Files referenced by the configuration are part of the key with their contents
+        std::vector<std::filesystem::path> inputFiles;
+        auto addRetentionProfile = [&inputFiles](DRAMSys::Config::McConfig const &mcConfig)
+        {
+            if (mcConfig.RetentionProfile.has_value())
+                inputFiles.emplace_back(*mcConfig.RetentionProfile);
+        };
+        addRetentionProfile(configuration.mcconfig);
+
+        if (configuration.tiers.has_value())
+        {
+            for (std::size_t i = 0; i < configuration.tiers->size(); i++)
+            {
+                DRAMSys::Config::Configuration tierConfiguration = DRAMSys::Config::from_path(
+                    (resourceDirectory / (*configuration.tiers)[i].config).c_str(),
+                    resourceDirectory.c_str());
+                addRetentionProfile(tierConfiguration.mcconfig);
+                resolvedConfiguration["tiers"][i]["config"] = tierConfiguration;
+            }
+        }
+
+        for (auto const &initiator_config : configuration.tracesetup.value())
+        {
+            if (auto const *player = std::get_if<DRAMSys::Config::TracePlayer>(&initiator_config))
+                inputFiles.push_back(resourceDirectory / TRACE_DIRECTORY / player->name);
+        }
+
+        resultCache.emplace(*cacheDirectory, DRAMSYS_VERSION);
+        resultCacheKey = resultCache->computeKey(resolvedConfiguration, inputFiles);
+
+        if (auto result = resultCache->lookup(resultCacheKey))
+        {
+            std::cout << result->output;
+            for (auto const &databaseFile : result->databaseFiles)
+                std::cout << "Database: " << databaseFile << std::endl;
+            std::cout << "Result restored from cache entry " << resultCacheKey << "." << std::endl;
+            return 0;
+        }
+    }
+
+    std::optional<OutputCapture> outputCapture;
+    if (resultCache)
+        outputCapture.emplace(std::cout);
+
     std::unique_ptr<DRAMSys::DRAMSys> dramSys;
     if (configuration.simconfig.DatabaseRecording.value_or(false))
     {
@@ -98,19 +207,88 @@ int sc_main(int argc, char **argv)
             sc_core::sc_stop();
     };
 
-    uint64_t totalTransactions{};
-    uint64_t transactionsFinished = 0;
-    auto transactionFinished = [&totalTransactions, &transactionsFinished, &configuration]()
+    unsigned int telemetryInterval = configuration.simconfig.TelemetryInterval.value_or(0);
+    std::string telemetryFile =
+        telemetryInterval > 0 ? dramSys->getConfig().simulationName + "_telemetry.bin" : "";
+    Telemetry telemetry(*dramSys,
+                        telemetryFile,
+                        std::chrono::milliseconds(telemetryInterval > 0 ? telemetryInterval : 1000),
+                        configuration.simconfig.SimulationProgressBar.value_or(false));
+
+    // Optional virtual-to-physical translation stage between the initiators and DRAMSys
+    std::unique_ptr<PageTranslator> pageTranslator;
+    if (const auto &pageTranslation = configuration.simconfig.PageTranslation)
     {
-        transactionsFinished++;
+        std::vector<std::string> initiatorNames;
+        for (auto const &initiator_config : configuration.tracesetup.value())
+            initiatorNames.push_back(
+                std::visit([](auto &&config) { return config.name; }, initiator_config));
 
-        if (configuration.simconfig.SimulationProgressBar.value_or(false))
-            loadBar(transactionsFinished, totalTransactions);
-    };
+        pageTranslator = std::make_unique<PageTranslator>(
+            "PageTranslator",
+            *pageTranslation,
+            configuration.simconfig.PageSize.value_or(4096),
+            configuration.simconfig.PageTranslationSeed.value_or(0),
+            std::move(initiatorNames),
+            *dramSys->getConfig().memSpec,
+            dramSys->getAddressDecoder());
+    }
+
+    // Optional further memory subsystems behind their own address ranges, the memory configured
+    // above is the first tier
+    std::vector<std::unique_ptr<DRAMSys::DRAMSys>> tierMemories;
+    std::unique_ptr<TieredMemory> tieredMemory;
+    if (configuration.tiers.has_value())
+    {
+        std::vector<TieredMemory::Tier> tiers{{dramSys.get(), 0, 0}};
+
+        for (auto const &tier : configuration.tiers.value())
+        {
+            DRAMSys::Config::Configuration tierConfiguration = DRAMSys::Config::from_path(
+                (resourceDirectory / tier.config).c_str(), resourceDirectory.c_str());
+            std::string tierName = "DRAMSys_tier" + std::to_string(tiers.size());
+
+            if (tierConfiguration.simconfig.DatabaseRecording.value_or(false))
+            {
+                tierMemories.push_back(std::make_unique<DRAMSys::DRAMSysRecordable>(
+                    tierName.c_str(), tierConfiguration));
+            }
+            else
+            {
+                tierMemories.push_back(
+                    std::make_unique<DRAMSys::DRAMSys>(tierName.c_str(), tierConfiguration));
+            }
+
+            tiers.push_back({tierMemories.back().get(), tier.base, tier.offset.value_or(0)});
+        }
+
+        tieredMemory = std::make_unique<TieredMemory>("TieredMemory",
+                                                      tiers,
+                                                      configuration.migration,
+                                                      configuration.tracesetup->size());
+    }
+
+    if (auto *eventLog = dramSys->getEventLog())
+        eventLogs.push_back(eventLog);
+    for (auto const &tierMemory : tierMemories)
+    {
+        if (auto *eventLog = tierMemory->getEventLog())
+            eventLogs.push_back(eventLog);
+    }
+    installEventLogHandlers();
+
+    tlm_utils::multi_target_base<> &memoryTarget =
+        tieredMemory ? static_cast<tlm_utils::multi_target_base<> &>(tieredMemory->tSocket)
+                     : dramSys->tSocket;
+
+    uint64_t totalTransactions{};
+    auto transactionFinished = [&telemetry]() { telemetry.transactionFinished(); };
 
     for (auto const &initiator_config : configuration.tracesetup.value())
     {
-        uint64_t memorySize = dramSys->getConfig().memSpec->getSimMemSizeInBytes();
+        uint64_t memorySize = tieredMemory
+                                  ? tieredMemory->getSize()
+                                  : dramSys->getConfig().memSpec->getSimMemSizeInBytes();
         unsigned int defaultDataLength = dramSys->getConfig().memSpec->defaultBytesPerBurst;
 
         auto initiator = std::visit(
@@ -152,6 +330,7 @@ int sc_main(int argc, char **argv)
                                                                         memoryManager,
                                                                         std::nullopt,
                                                                         std::nullopt,
+                                                                        config.latencyBudgetNs,
                                                                         transactionFinished,
                                                                         termianteInitiator,
                                                                         std::move(player));
@@ -165,6 +344,7 @@ int sc_main(int argc, char **argv)
                                                                         memoryManager,
                                                                         1,
                                                                         1,
+                                                                        std::nullopt,
                                                                         transactionFinished,
                                                                         termianteInitiator,
                                                                         std::move(hammer));
@@ -174,23 +354,55 @@ int sc_main(int argc, char **argv)
 
         totalTransactions += initiator->totalRequests();
 
-        initiator->bind(dramSys->tSocket);
+        if (pageTranslator)
+        {
+            initiator->bind(pageTranslator->tSocket);
+            pageTranslator->iSocket.bind(memoryTarget);
+        }
+        else
+        {
+            initiator->bind(memoryTarget);
+        }
         initiators.push_back(std::move(initiator));
     }
 
     // Store the starting of the simulation in wall-clock time:
     auto start = std::chrono::high_resolution_clock::now();
+
+    bool telemetryEnabled = !telemetryFile.empty() ||
+                            configuration.simconfig.SimulationProgressBar.value_or(false);
+    if (telemetryEnabled)
+        telemetry.start(totalTransactions);
     
     // Start the SystemC simulation
     sc_set_stop_mode(sc_core::SC_STOP_FINISH_DELTA);
     sc_core::sc_start();
     
-    if (!sc_core::sc_end_of_simulation_invoked())
+    bool simulationFinished = sc_core::sc_end_of_simulation_invoked();
+    if (!simulationFinished)
     {
         SC_REPORT_WARNING("sc_main", "Simulation stopped without explicit sc_stop()");
         sc_core::sc_stop();
     }
 
+    telemetry.finish();
+
+    if (resultCache)
+    {
+        std::vector<std::string> databaseFiles = dramSys->getDatabaseFiles();
+        for (auto const &tierMemory : tierMemories)
+        {
+            std::vector<std::string> tierDatabaseFiles = tierMemory->getDatabaseFiles();
+            databaseFiles.insert(databaseFiles.end(), tierDatabaseFiles.begin(), tierDatabaseFiles.end());
+        }
+
+        std::string output = outputCapture->text();
+        outputCapture.reset();
+
+        if (simulationFinished)
+            resultCache->store(resultCacheKey, {output, databaseFiles});
+    }
+
     auto finish = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> elapsed = finish - start;
     std::cout << "Simulation took " + std::to_string(elapsed.count()) + " seconds." << std::endl;
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+
+#include "PageTranslator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+using namespace sc_core;
+using namespace tlm;
+
+PageTranslator::PageTranslator(sc_module_name const &name,
+                               DRAMSys::Config::PageTranslationType policy,
+                               unsigned int pageSize,
+                               uint64_t seed,
+                               std::vector<std::string> initiatorNames,
+                               DRAMSys::MemSpec const &memSpec,
+                               DRAMSys::AddressDecoder const &addressDecoder) :
+    sc_module(name),
+    policy(policy),
+    pageBits(static_cast<unsigned int>(std::log2(pageSize))),
+    pageSize(pageSize),
+    numberOfFrames(memSpec.getSimMemSizeInBytes() / pageSize),
+    banksPerChannel(memSpec.banksPerChannel),
+    numberOfBanks(memSpec.banksPerChannel * memSpec.numberOfChannels),
+    bytesPerBurst(memSpec.defaultBytesPerBurst),
+    initiatorNames(std::move(initiatorNames)),
+    addressDecoder(addressDecoder),
+    bankColors(std::min<unsigned int>(this->initiatorNames.size(), numberOfBanks)),
+    channelColors(std::min<unsigned int>(this->initiatorNames.size(), memSpec.numberOfChannels)),
+    pageTables(this->initiatorNames.size()),
+    allocatedFrames(numberOfFrames, false),
+    randomGenerator(seed),
+    randomFrame(0, numberOfFrames - 1)
+{
+    if (pageSize == 0 || (pageSize & (pageSize - 1)) != 0 || pageSize < bytesPerBurst)
+        SC_REPORT_FATAL("PageTranslator", "Page size must be a power of two of at least one burst!");
+
+    if (policy == DRAMSys::Config::PageTranslationType::Invalid)
+        SC_REPORT_FATAL("PageTranslator", "Invalid PageTranslation");
+
+    // With bank or channel bits inside the page offset every page spans several colors
+    if (policy == DRAMSys::Config::PageTranslationType::BankColored ||
+        policy == DRAMSys::Config::PageTranslationType::ChannelPartitioned)
+    {
+        for (uint64_t offset = bytesPerBurst; offset < pageSize; offset += bytesPerBurst)
+        {
+            if (colorOf(offset) != colorOf(0))
+                SC_REPORT_FATAL("PageTranslator",
+                                "The address mapping spreads a page over banks or channels of "
+                                "different colors, choose a smaller PageSize");
+        }
+    }
+
+    for (auto &pageTable : pageTables)
+    {
+        pageTable.pagesPerBank = std::vector<uint64_t>(numberOfBanks, 0);
+        pageTable.frames.reserve(1024);
+    }
+
+    tSocket.register_nb_transport_fw(this, &PageTranslator::nb_transport_fw);
+    iSocket.register_nb_transport_bw(this, &PageTranslator::nb_transport_bw);
+}
+
+tlm_sync_enum PageTranslator::nb_transport_fw(int id,
+                                              tlm_generic_payload &payload,
+                                              tlm_phase &phase,
+                                              sc_time &fwDelay)
+{
+    if (phase == BEGIN_REQ)
+        payload.set_address(
+            translate(static_cast<unsigned int>(id), payload.get_address(), payload.get_data_length()));
+
+    return iSocket[id]->nb_transport_fw(payload, phase, fwDelay);
+}
+
+tlm_sync_enum PageTranslator::nb_transport_bw(int id,
+                                              tlm_generic_payload &payload,
+                                              tlm_phase &phase,
+                                              sc_time &bwDelay)
+{
+    return tSocket[id]->nb_transport_bw(payload, phase, bwDelay);
+}
+
+uint64_t PageTranslator::translate(unsigned int initiator, uint64_t address, unsigned int length)
+{
+    // A request that crosses a page boundary is translated by its first page, its remaining bytes
+    // access the physically following frame
+    uint64_t offset = address & (pageSize - 1);
+    PageTable &pageTable = pageTables[initiator];
+    if (offset + length > pageSize)
+        pageTable.crossingRequests++;
+    uint64_t page = address >> pageBits;
+
+    // Streams hit the same page many times in a row
+    if (page != pageTable.lastPage)
+    {
+        auto it = pageTable.frames.find(page);
+        if (it == pageTable.frames.end())
+            it = pageTable.frames.emplace(page, allocateFrame(initiator)).first;
+
+        pageTable.lastPage = page;
+        pageTable.lastFrame = it->second;
+    }
+
+    return (pageTable.lastFrame << pageBits) | offset;
+}
+
+uint64_t PageTranslator::allocateFrame(unsigned int initiator)
+{
+    uint64_t frame = 0;
+    if (policy == DRAMSys::Config::PageTranslationType::Sequential)
+    {
+        frame = findFreeFrame(sequentialCursor, initiator, false);
+    }
+    else if (policy == DRAMSys::Config::PageTranslationType::Random)
+    {
+        uint64_t cursor = randomFrame(randomGenerator);
+        frame = findFreeFrame(cursor, initiator, false);
+    }
+    else
+    {
+        frame = findFreeFrame(pageTables[initiator].cursor, initiator, true);
+    }
+
+    recordBanks(initiator, frame);
+    return frame;
+}
+
+uint64_t PageTranslator::findFreeFrame(uint64_t &cursor, unsigned int initiator, bool colored)
+{
+    for (uint64_t probe = 0; probe < numberOfFrames; probe++)
+    {
+        uint64_t frame = cursor;
+        cursor = cursor + 1 == numberOfFrames ? 0 : cursor + 1;
+
+        if (!allocatedFrames[frame] && (!colored || isOwnFrame(initiator, frame)))
+        {
+            allocatedFrames[frame] = true;
+            return frame;
+        }
+    }
+
+    SC_REPORT_FATAL("PageTranslator", ("No free frame left for " + initiatorNames[initiator]).c_str());
+    return 0;
+}
+
+unsigned int PageTranslator::colorOf(uint64_t address) const
+{
+    DRAMSys::DecodedAddress decodedAddress = addressDecoder.decodeAddress(address);
+
+    if (policy == DRAMSys::Config::PageTranslationType::BankColored)
+        return (decodedAddress.channel * banksPerChannel + decodedAddress.bank) % bankColors;
+
+    return decodedAddress.channel % channelColors;
+}
+
+bool PageTranslator::isOwnFrame(unsigned int initiator, uint64_t frame) const
+{
+    // Depending on the address mapping a page is spread over several banks, all of them must
+    // belong to the initiator
+    unsigned int color = initiator % (policy == DRAMSys::Config::PageTranslationType::BankColored
+                                          ? bankColors : channelColors);
+    for (uint64_t offset = 0; offset < pageSize; offset += bytesPerBurst)
+    {
+        if (colorOf((frame << pageBits) | offset) != color)
+            return false;
+    }
+    return true;
+}
+
+void PageTranslator::recordBanks(unsigned int initiator, uint64_t frame)
+{
+    // Depending on the address mapping a page is spread over several banks
+    std::vector<bool> touched(numberOfBanks, false);
+    for (uint64_t offset = 0; offset < pageSize; offset += bytesPerBurst)
+    {
+        DRAMSys::DecodedAddress decodedAddress = addressDecoder.decodeAddress((frame << pageBits) | offset);
+        touched[decodedAddress.channel * banksPerChannel + decodedAddress.bank] = true;
+    }
+
+    for (unsigned int bank = 0; bank < numberOfBanks; bank++)
+    {
+        if (touched[bank])
+            pageTables[initiator].pagesPerBank[bank]++;
+    }
+}
+
+void PageTranslator::end_of_simulation()
+{
+    for (unsigned int initiator = 0; initiator < pageTables.size(); initiator++)
+    {
+        const PageTable &pageTable = pageTables[initiator];
+
+        unsigned int usedBanks = 0;
+        unsigned int sharedBanks = 0;
+        uint64_t bankPages = 0;
+        uint64_t sharedBankPages = 0;
+        std::vector<bool> usedChannels(numberOfBanks / banksPerChannel, false);
+
+        for (unsigned int bank = 0; bank < numberOfBanks; bank++)
+        {
+            if (pageTable.pagesPerBank[bank] == 0)
+                continue;
+
+            usedBanks++;
+            bankPages += pageTable.pagesPerBank[bank];
+            usedChannels[bank / banksPerChannel] = true;
+
+            bool shared = false;
+            for (unsigned int other = 0; other < pageTables.size(); other++)
+                shared = shared || (other != initiator && pageTables[other].pagesPerBank[bank] != 0);
+
+            if (shared)
+            {
+                sharedBanks++;
+                sharedBankPages += pageTable.pagesPerBank[bank];
+            }
+        }
+
+        std::cout << name() << "  " << initiatorNames[initiator] << ": " << pageTable.frames.size() << " pages, "
+                  << usedBanks << " banks in " << std::count(usedChannels.begin(), usedChannels.end(), true)
+                  << " channels, " << sharedBanks << " banks shared with other initiators ("
+                  << std::fixed << std::setprecision(2)
+                  << (bankPages == 0 ? 0.0 : static_cast<double>(sharedBankPages) / static_cast<double>(bankPages) * 100.0)
+                  << " % of the page mappings)" << std::endl;
+
+        if (pageTable.crossingRequests != 0)
+        {
+            std::cout << name() << "  " << initiatorNames[initiator] << ": " << pageTable.crossingRequests
+                      << " requests crossed a page boundary and were translated by their first page" << std::endl;
+        }
+    }
+}
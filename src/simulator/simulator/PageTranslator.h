@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+
+#pragma once
+
+#include <DRAMSys/config/DRAMSysConfiguration.h>
+#include <DRAMSys/simulation/AddressDecoder.h>
+
+#include <systemc>
+#include <tlm>
+#include <tlm_utils/multi_passthrough_initiator_socket.h>
+#include <tlm_utils/multi_passthrough_target_socket.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Treats the addresses of each initiator as virtual addresses and maps them page by page to
+// physical frames. The initiator with socket ID n is forwarded on initiator socket n, so the
+// arbiter still sees every initiator as a separate thread.
+class PageTranslator : public sc_core::sc_module
+{
+public:
+    tlm_utils::multi_passthrough_target_socket<PageTranslator> tSocket;
+    tlm_utils::multi_passthrough_initiator_socket<PageTranslator> iSocket;
+
+    PageTranslator(sc_core::sc_module_name const &name,
+                   DRAMSys::Config::PageTranslationType policy,
+                   unsigned int pageSize,
+                   uint64_t seed,
+                   std::vector<std::string> initiatorNames,
+                   DRAMSys::MemSpec const &memSpec,
+                   DRAMSys::AddressDecoder const &addressDecoder);
+
+private:
+    struct PageTable
+    {
+        std::unordered_map<uint64_t, uint64_t> frames;
+        uint64_t lastPage = UINT64_MAX;
+        uint64_t lastFrame = 0;
+        uint64_t cursor = 0;
+        std::vector<uint64_t> pagesPerBank;
+        uint64_t crossingRequests = 0;
+    };
+
+    uint64_t translate(unsigned int initiator, uint64_t address, unsigned int length);
+    uint64_t allocateFrame(unsigned int initiator);
+    uint64_t findFreeFrame(uint64_t &cursor, unsigned int initiator, bool colored);
+    unsigned int colorOf(uint64_t address) const;
+    bool isOwnFrame(unsigned int initiator, uint64_t frame) const;
+    void recordBanks(unsigned int initiator, uint64_t frame);
+
+    void end_of_simulation() override;
+
+    tlm::tlm_sync_enum nb_transport_fw(int id,
+                                       tlm::tlm_generic_payload &payload,
+                                       tlm::tlm_phase &phase,
+                                       sc_core::sc_time &fwDelay);
+    tlm::tlm_sync_enum nb_transport_bw(int id,
+                                       tlm::tlm_generic_payload &payload,
+                                       tlm::tlm_phase &phase,
+                                       sc_core::sc_time &bwDelay);
+
+    const DRAMSys::Config::PageTranslationType policy;
+    const unsigned int pageBits;
+    const uint64_t pageSize;
+    const uint64_t numberOfFrames;
+    const unsigned int banksPerChannel;
+    const unsigned int numberOfBanks;
+    const unsigned int bytesPerBurst;
+    const std::vector<std::string> initiatorNames;
+    DRAMSys::AddressDecoder const &addressDecoder;
+
+    // Number of bank and channel colors, initiator n owns the colors congruent to n
+    const unsigned int bankColors;
+    const unsigned int channelColors;
+
+    std::vector<PageTable> pageTables;
+    std::vector<bool> allocatedFrames;
+    uint64_t sequentialCursor = 0;
+    std::mt19937_64 randomGenerator;
+    std::uniform_int_distribution<uint64_t> randomFrame;
+};
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+
+#include "ResultCache.h"
+
+#include <systemc>
+
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+ResultCache::ResultCache(fs::path directory, std::string version) :
+    directory(std::move(directory)),
+    version(std::move(version))
+{
+    std::error_code error;
+    fs::create_directories(this->directory, error);
+    if (error)
+        SC_REPORT_WARNING("ResultCache", ("Could not create " + this->directory.string() + ": " +
+                                          error.message()).c_str());
+
+    std::ifstream file(this->directory / "digests.json");
+    if (file.is_open())
+        fileDigests = nlohmann::json::parse(file, nullptr, false);
+
+    if (!fileDigests.is_object())
+        fileDigests = nlohmann::json::object();
+}
+
+void ResultCache::Digest::update(char const *data, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        auto byte = static_cast<uint8_t>(data[i]);
+        lane0 = (lane0 ^ byte) * 0x100000001b3;
+        lane1 = (lane1 ^ byte) * 0xff51afd7ed558ccd;
+        lane1 ^= lane1 >> 29;
+    }
+}
+
+std::string ResultCache::Digest::toString() const
+{
+    std::ostringstream stream;
+    stream << std::hex << std::setfill('0') << std::setw(16) << lane0 << std::setw(16) << lane1;
+    return stream.str();
+}
+
+std::string ResultCache::fileDigest(fs::path const &inputFile)
+{
+    // A missing file makes the simulation fail anyway, it only contributes its path to the key
+    std::error_code error;
+    if (!fs::is_regular_file(inputFile, error))
+        return inputFile.string();
+
+    std::string path = fs::absolute(inputFile, error).string();
+    if (error)
+        return inputFile.string();
+    auto size = static_cast<uint64_t>(fs::file_size(inputFile, error));
+    if (error)
+        return inputFile.string();
+    auto modified = static_cast<int64_t>(fs::last_write_time(inputFile, error).time_since_epoch().count());
+    if (error)
+        return inputFile.string();
+
+    auto it = fileDigests.find(path);
+    if (it != fileDigests.end() && it->value("size", uint64_t(0)) == size &&
+        it->value("modified", int64_t(0)) == modified)
+        return it->value("digest", std::string());
+
+    Digest digest;
+    std::ifstream file(inputFile, std::ios::binary);
+    std::vector<char> buffer(1 << 20);
+    while (file.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || file.gcount() > 0)
+        digest.update(buffer.data(), static_cast<std::size_t>(file.gcount()));
+
+    fileDigests[path] = {{"size", size}, {"modified", modified}, {"digest", digest.toString()}};
+    saveDigests();
+
+    return digest.toString();
+}
+
+void ResultCache::saveDigests()
+{
+    // Merged with the digests that other runs have stored in the meantime. A digest that is lost in
+    // a race is only computed again by a later run.
+    std::ifstream file(directory / "digests.json");
+    if (file.is_open())
+    {
+        nlohmann::json stored = nlohmann::json::parse(file, nullptr, false);
+        if (stored.is_object())
+        {
+            for (auto it = stored.begin(); it != stored.end(); ++it)
+            {
+                if (!fileDigests.contains(it.key()))
+                    fileDigests[it.key()] = it.value();
+            }
+        }
+    }
+
+    fs::path temporary = temporaryPath("digests.json");
+    std::ofstream(temporary) << fileDigests.dump();
+
+    std::error_code error;
+    fs::rename(temporary, directory / "digests.json", error);
+    if (error)
+    {
+        SC_REPORT_WARNING("ResultCache", ("Could not store the file digests: " + error.message()).c_str());
+        fs::remove(temporary, error);
+    }
+}
+
+fs::path ResultCache::temporaryPath(std::string const &name) const
+{
+#ifdef _WIN32
+    int processID = _getpid();
+#else
+    int processID = getpid();
+#endif
+    std::random_device randomDevice;
+    uint64_t suffix = (static_cast<uint64_t>(randomDevice()) << 32) | randomDevice();
+
+    std::ostringstream path;
+    path << name << "." << processID << "." << std::hex << suffix << ".tmp";
+    return directory / path.str();
+}
+
+bool ResultCache::isValidEntry(fs::path const &entry) const
+{
+    std::ifstream metadataFile(entry / "result.json");
+    if (!metadataFile.is_open())
+        return false;
+
+    nlohmann::json metadata = nlohmann::json::parse(metadataFile, nullptr, false);
+    return !metadata.is_discarded() && metadata.value("version", std::string()) == version &&
+           metadata.value("format", 0) == ENTRY_FORMAT;
+}
+
+std::string ResultCache::computeKey(nlohmann::json const &configuration,
+                                    std::vector<fs::path> const &inputFiles)
+{
+    // nlohmann::json stores objects sorted by key, so the dump is canonical
+    Digest digest;
+    std::string text = configuration.dump();
+    digest.update(text.data(), text.size());
+    digest.update(version.data(), version.size());
+
+    for (auto const &inputFile : inputFiles)
+    {
+        std::string fileHash = fileDigest(inputFile);
+        digest.update(fileHash.data(), fileHash.size());
+    }
+
+    return digest.toString();
+}
+
+std::optional<ResultCache::Result> ResultCache::lookup(std::string const &key) const
+{
+    fs::path entry = directory / key;
+    std::ifstream outputFile(entry / "output.txt");
+    if (!outputFile.is_open() || !isValidEntry(entry))
+        return std::nullopt;
+
+    std::ifstream metadataFile(entry / "result.json");
+    nlohmann::json metadata = nlohmann::json::parse(metadataFile, nullptr, false);
+    auto databases = metadata.value("databases", nlohmann::json::array());
+    std::error_code error;
+    for (auto const &database : databases)
+    {
+        if (!fs::is_regular_file(entry / database.value("copy", std::string()), error))
+            return std::nullopt;
+    }
+
+    // The database files are named after the simulation only, so a later simulation with another
+    // configuration may have overwritten them. The stored copies are restored to the original paths.
+    Result result;
+    for (auto const &database : databases)
+    {
+        fs::path path = database.value("path", std::string());
+        if (path.has_parent_path())
+            fs::create_directories(path.parent_path(), error);
+        fs::copy_file(entry / database.value("copy", std::string()), path,
+                      fs::copy_options::overwrite_existing, error);
+        if (error)
+        {
+            SC_REPORT_WARNING("ResultCache", ("Could not restore " + path.string() + ": " +
+                                              error.message()).c_str());
+            return std::nullopt;
+        }
+        result.databaseFiles.push_back(path.string());
+    }
+
+    std::ostringstream output;
+    output << outputFile.rdbuf();
+    result.output = output.str();
+    return result;
+}
+
+void ResultCache::store(std::string const &key, Result const &result) const
+{
+    // Written into a temporary directory first, so that an aborted run leaves no partial entry
+    fs::path entry = directory / key;
+    fs::path temporary = temporaryPath(key);
+    std::error_code error;
+    std::error_code cleanupError;
+
+    auto fail = [&](std::string const &reason)
+    {
+        SC_REPORT_WARNING("ResultCache", ("Could not store cache entry " + key + ": " + reason).c_str());
+        fs::remove_all(temporary, cleanupError);
+    };
+
+    fs::create_directories(temporary, error);
+    if (error)
+        return fail(error.message());
+
+    nlohmann::json databases = nlohmann::json::array();
+    for (std::size_t index = 0; index < result.databaseFiles.size(); index++)
+    {
+        fs::path path = fs::absolute(result.databaseFiles[index], error);
+        std::string copy = std::to_string(index) + "_" + path.filename().string();
+        if (!error)
+            fs::copy_file(path, temporary / copy, error);
+        if (error)
+            return fail(error.message());
+        databases.push_back({{"path", path.string()}, {"copy", copy}});
+    }
+
+    nlohmann::json metadata = {{"version", version}, {"format", ENTRY_FORMAT}, {"databases", databases}};
+    std::ofstream metadataFile(temporary / "result.json");
+    metadataFile << metadata.dump(4);
+    std::ofstream outputFile(temporary / "output.txt");
+    outputFile << result.output;
+    metadataFile.close();
+    outputFile.close();
+    if (!metadataFile || !outputFile)
+        return fail("write error");
+
+    // An entry of an older format is replaced, an entry that another run has stored under the same
+    // key in the meantime has the same content and is kept
+    if (!isValidEntry(entry))
+        fs::remove_all(entry, cleanupError);
+
+    fs::rename(temporary, entry, error);
+    if (error)
+    {
+        if (isValidEntry(entry))
+            fs::remove_all(temporary, cleanupError);
+        else
+            fail(error.message());
+    }
+}
+
+OutputCapture::OutputCapture(std::ostream &stream) : stream(stream), original(stream.rdbuf(this))
+{
+}
+
+OutputCapture::~OutputCapture()
+{
+    stream.rdbuf(original);
+}
+
+OutputCapture::int_type OutputCapture::overflow(int_type character)
+{
+    if (traits_type::eq_int_type(character, traits_type::eof()))
+        return traits_type::not_eof(character);
+
+    captured.push_back(traits_type::to_char_type(character));
+    return original->sputc(traits_type::to_char_type(character));
+}
+
+std::streamsize OutputCapture::xsputn(char const *data, std::streamsize size)
+{
+    captured.append(data, static_cast<std::size_t>(size));
+    return original->sputn(data, size);
+}
+
+int OutputCapture::sync()
+{
+    return original->pubsync();
+}
+
+std::string OutputCapture::text() const
+{
+    std::string text;
+    std::istringstream lines(captured);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        std::size_t carriageReturn = line.rfind('\r');
+        if (carriageReturn == std::string::npos)
+            text += line + '\n';
+        else if (carriageReturn + 1 < line.size())
+            text += line.substr(carriageReturn + 1) + '\n';
+    }
+    return text;
+}
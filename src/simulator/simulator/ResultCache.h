@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+
+#pragma once
+
+#include <DRAMSys/util/json.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Stores the console output and copies of the database files of finished simulations in a directory, keyed
+// by a hash over the resolved configuration, the contents of the input files (traces and other files
+// referenced by the configuration) and the simulator version. The digests of the input files are
+// cached by path, size and modification time. Several processes may share the directory, failures to
+// write to the cache are reported as warnings and never end the simulation.
+class ResultCache
+{
+public:
+    struct Result
+    {
+        std::string output;
+        std::vector<std::string> databaseFiles;
+    };
+
+    ResultCache(std::filesystem::path directory, std::string version);
+
+    std::string computeKey(nlohmann::json const &configuration,
+                           std::vector<std::filesystem::path> const &inputFiles);
+
+    // On a hit the stored database files are copied back to the paths they were recorded to
+    std::optional<Result> lookup(std::string const &key) const;
+    void store(std::string const &key, Result const &result) const;
+
+private:
+    // Incremented whenever the layout of an entry changes, older entries are treated as misses
+    static constexpr int ENTRY_FORMAT = 2;
+
+    struct Digest
+    {
+        uint64_t lane0 = 0xcbf29ce484222325;
+        uint64_t lane1 = 0x9e3779b97f4a7c15;
+
+        void update(char const *data, std::size_t size);
+        std::string toString() const;
+    };
+
+    std::string fileDigest(std::filesystem::path const &inputFile);
+    void saveDigests();
+    bool isValidEntry(std::filesystem::path const &entry) const;
+
+    // Unique per process and call, so that concurrent runs never write into the same file
+    std::filesystem::path temporaryPath(std::string const &name) const;
+
+    const std::filesystem::path directory;
+    const std::string version;
+    nlohmann::json fileDigests;
+};
+
+// Duplicates everything written to a stream into a string while it is alive
+class OutputCapture : public std::streambuf
+{
+public:
+    explicit OutputCapture(std::ostream &stream);
+    ~OutputCapture() override;
+
+    // Captured text without progress lines that are overwritten with a carriage return
+    std::string text() const;
+
+protected:
+    int_type overflow(int_type character) override;
+    std::streamsize xsputn(char const *data, std::streamsize size) override;
+    int sync() override;
+
+private:
+    std::ostream &stream;
+    std::streambuf *original;
+    std::string captured;
+};
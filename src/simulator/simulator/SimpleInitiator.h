@@ -46,6 +46,7 @@ public:
                     MemoryManager &memoryManager,
                     std::optional<unsigned int> maxPendingReadRequests,
                     std::optional<unsigned int> maxPendingWriteRequests,
+                    std::optional<unsigned int> latencyBudgetNs,
                     std::function<void()> transactionFinished,
                     std::function<void()> terminate,
                     Producer &&producer)
@@ -55,6 +56,7 @@ public:
               memoryManager,
               maxPendingReadRequests,
               maxPendingWriteRequests,
+              latencyBudgetNs,
               [this] { return this->producer.nextRequest(); },
               std::move(transactionFinished),
               std::move(terminate))
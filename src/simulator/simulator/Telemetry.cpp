@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+
+#include "Telemetry.h"
+
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+Telemetry::Telemetry(DRAMSys::DRAMSys const &dramSys,
+                     std::string const &fileName,
+                     std::chrono::milliseconds interval,
+                     bool progressLine)
+    : dramSys(dramSys),
+      interval(interval),
+      progressLine(progressLine),
+      numberOfChannels(
+          std::min(dramSys.getConfig().memSpec->numberOfChannels, TelemetryPage::MAX_CHANNELS)),
+      bytesPerBeat(dramSys.getConfig().memSpec->bitWidth *
+                   dramSys.getConfig().memSpec->devicesPerRank / 8.0),
+      lastBeatsServed(numberOfChannels, 0)
+{
+#ifndef _WIN32
+    if (!fileName.empty())
+    {
+        fileDescriptor = open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fileDescriptor < 0 || ftruncate(fileDescriptor, sizeof(TelemetryPage)) != 0)
+        {
+            SC_REPORT_WARNING("Telemetry", ("Could not create " + fileName).c_str());
+        }
+        else
+        {
+            void *mapping = mmap(nullptr,
+                                 sizeof(TelemetryPage),
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_SHARED,
+                                 fileDescriptor,
+                                 0);
+            if (mapping != MAP_FAILED)
+                page = static_cast<TelemetryPage *>(mapping);
+            else
+                SC_REPORT_WARNING("Telemetry", ("Could not map " + fileName).c_str());
+        }
+    }
+#else
+    if (!fileName.empty())
+        SC_REPORT_WARNING("Telemetry", "Telemetry file is not supported on Windows");
+#endif
+
+    std::memcpy(page->magic, "DSYSTEL1", sizeof(page->magic));
+    page->version = 1;
+    page->numberOfChannels = numberOfChannels;
+    page->sequence = 0;
+}
+
+Telemetry::~Telemetry()
+{
+    finish();
+
+#ifndef _WIN32
+    if (page != &localPage)
+        munmap(page, sizeof(TelemetryPage));
+    if (fileDescriptor >= 0)
+        close(fileDescriptor);
+#endif
+}
+
+void Telemetry::start(uint64_t totalTransactions)
+{
+    page->totalTransactions = totalTransactions;
+    startTime = std::chrono::steady_clock::now();
+    lastSampleTime = startTime;
+
+    timer = std::thread(&Telemetry::timerLoop, this);
+}
+
+void Telemetry::finish()
+{
+    if (!timer.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(timerMutex);
+        stopTimer = true;
+    }
+    timerCondition.notify_one();
+    timer.join();
+
+    sample();
+    if (progressLine)
+        std::cout << std::endl;
+}
+
+void Telemetry::timerLoop()
+{
+    std::unique_lock<std::mutex> lock(timerMutex);
+    while (!timerCondition.wait_for(lock, interval, [this] { return stopTimer; }))
+        sampleRequested.store(true, std::memory_order_relaxed);
+}
+
+void Telemetry::sample()
+{
+    sampleRequested.store(false, std::memory_order_relaxed);
+
+    auto now = std::chrono::steady_clock::now();
+    double intervalSeconds = std::chrono::duration<double>(now - lastSampleTime).count();
+    double totalSeconds = std::chrono::duration<double>(now - startTime).count();
+    sc_core::sc_time simulatedTime = sc_core::sc_time_stamp();
+    double simulatedSeconds = (simulatedTime - lastSimulatedTime).to_seconds();
+
+    // Seqlock protocol, the sequence number is odd while the page is updated
+    page->sequence = page->sequence + 1;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    page->wallClockNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - startTime).count();
+    page->simulatedTimePs = static_cast<uint64_t>(simulatedTime.to_seconds() * 1e12);
+    page->transactionsFinished = transactionsFinished;
+    page->recorderQueueDepth = dramSys.getRecorderQueueDepth();
+    page->transactionsPerSecond =
+        intervalSeconds > 0 ? (transactionsFinished - lastTransactionsFinished) / intervalSeconds
+                            : 0.0;
+
+    uint64_t remainingTransactions = page->totalTransactions > transactionsFinished
+                                         ? page->totalTransactions - transactionsFinished
+                                         : 0;
+    page->etaSeconds = transactionsFinished > 0
+                           ? remainingTransactions * totalSeconds / transactionsFinished
+                           : 0.0;
+
+    for (unsigned int channel = 0; channel < numberOfChannels; channel++)
+    {
+        uint64_t beatsServed = dramSys.getNumberOfBeatsServed(channel);
+        page->channelBandwidth[channel] =
+            simulatedSeconds > 0
+                ? (beatsServed - lastBeatsServed[channel]) * bytesPerBeat / simulatedSeconds / 1e9
+                : 0.0;
+        lastBeatsServed[channel] = beatsServed;
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    page->sequence = page->sequence + 1;
+
+    lastTransactionsFinished = transactionsFinished;
+    lastSimulatedTime = simulatedTime;
+    lastSampleTime = now;
+
+    if (progressLine)
+        printProgressLine();
+}
+
+void Telemetry::printProgressLine() const
+{
+    constexpr unsigned int width = 50;
+
+    double ratio = page->totalTransactions > 0
+                       ? std::min(1.0,
+                                  static_cast<double>(page->transactionsFinished) /
+                                      static_cast<double>(page->totalTransactions))
+                       : 0.0;
+    auto filled = static_cast<unsigned int>(ratio * width);
+
+    auto eta = static_cast<uint64_t>(page->etaSeconds);
+
+    std::cout << std::setw(3) << std::round(ratio * 100) << "% |";
+    for (unsigned int x = 0; x < width; x++)
+        std::cout << (x < filled ? "█" : " ");
+    std::cout << "| " << sc_core::sc_time_stamp().to_string() << " | " << std::fixed
+              << std::setprecision(1) << page->transactionsPerSecond / 1000 << " kT/s | ETA "
+              << eta / 3600 << ":" << std::setfill('0') << std::setw(2) << eta / 60 % 60 << ":"
+              << std::setw(2) << eta % 60 << std::setfill(' ') << "   \r" << std::flush;
+}
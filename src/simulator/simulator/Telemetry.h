@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+
+#pragma once
+
+#include <DRAMSys/simulation/DRAMSys.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Layout of the telemetry file. A reader has to retry while the sequence number is odd or
+// changes during the read.
+struct TelemetryPage
+{
+    static constexpr unsigned int MAX_CHANNELS = 64;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t numberOfChannels;
+    volatile uint64_t sequence;
+
+    uint64_t wallClockNs;
+    uint64_t simulatedTimePs;
+    uint64_t transactionsFinished;
+    uint64_t totalTransactions;
+    uint64_t recorderQueueDepth;
+    double transactionsPerSecond;
+    double etaSeconds;
+    double channelBandwidth[MAX_CHANNELS]; // GB/s during the last interval
+};
+
+// Samples the simulation progress in wall-clock intervals. A timer thread only raises a flag,
+// the sample itself is taken by the simulation thread at the next finished transaction, so the
+// hot path is a single relaxed atomic load. Each sample is published into a memory-mapped file
+// and optionally printed as terminal progress line.
+class Telemetry
+{
+public:
+    Telemetry(DRAMSys::DRAMSys const &dramSys,
+              std::string const &fileName,
+              std::chrono::milliseconds interval,
+              bool progressLine);
+    ~Telemetry();
+
+    Telemetry(Telemetry const &) = delete;
+    Telemetry &operator=(Telemetry const &) = delete;
+
+    void start(uint64_t totalTransactions);
+    void finish();
+
+    void transactionFinished()
+    {
+        transactionsFinished++;
+
+        if (sampleRequested.load(std::memory_order_relaxed))
+            sample();
+    }
+
+private:
+    void sample();
+    void printProgressLine() const;
+    void timerLoop();
+
+    DRAMSys::DRAMSys const &dramSys;
+    std::chrono::milliseconds const interval;
+    bool const progressLine;
+    unsigned int const numberOfChannels;
+    double const bytesPerBeat;
+
+    uint64_t transactionsFinished = 0;
+    uint64_t lastTransactionsFinished = 0;
+    std::vector<uint64_t> lastBeatsServed;
+    sc_core::sc_time lastSimulatedTime;
+    std::chrono::steady_clock::time_point startTime;
+    std::chrono::steady_clock::time_point lastSampleTime;
+
+    TelemetryPage localPage{};
+    TelemetryPage *page = &localPage;
+    int fileDescriptor = -1;
+
+    std::atomic<bool> sampleRequested{false};
+    std::thread timer;
+    std::mutex timerMutex;
+    std::condition_variable timerCondition;
+    bool stopTimer = false;
+};
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+
+#include "TieredMemory.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+using namespace sc_core;
+using namespace tlm;
+
+TieredMemory::TieredMemory(sc_module_name const &name,
+                           std::vector<Tier> const &tiers,
+                           std::optional<DRAMSys::Config::TierMigration> const &migration,
+                           unsigned int numberOfInitiators) :
+    sc_module(name),
+    numberOfInitiators(numberOfInitiators),
+    migrationEnabled(migration.has_value()),
+    epoch(migration ? sc_time(static_cast<double>(migration->epochNs), SC_NS) : SC_ZERO_TIME),
+    pageSize(migration ? migration->pageSize.value_or(4096) : 4096),
+    threshold(migration ? migration->threshold.value_or(16) : 16),
+    pagesPerEpoch(migration ? migration->pagesPerEpoch.value_or(8) : 8),
+    storageEnabled(std::all_of(tiers.begin(),
+                               tiers.end(),
+                               [](Tier const &tier)
+                               {
+                                   return tier.memory->getConfig().storeMode ==
+                                          DRAMSys::Configuration::StoreMode::Store;
+                               })),
+    nextEpoch(epoch),
+    counters(migration ? migration->tableSize.value_or(4096) : 0),
+    memoryManager(storageEnabled),
+    migrationEventQueue(this, &TieredMemory::migrationCallback)
+{
+    tSocket.register_nb_transport_fw(this, &TieredMemory::nb_transport_fw);
+    iSocket.register_nb_transport_bw(this, &TieredMemory::nb_transport_bw);
+
+    if (tiers.empty() || tiers.front().base != 0)
+        SC_REPORT_FATAL("TieredMemory", "The first memory tier must start at address 0");
+
+    for (auto const &tier : tiers)
+    {
+        const DRAMSys::MemSpec &memSpec = *tier.memory->getConfig().memSpec;
+        uint64_t memorySize = memSpec.getSimMemSizeInBytes();
+
+        if (tier.offset >= memorySize)
+            SC_REPORT_FATAL("TieredMemory", "Tier offset exceeds the size of its memory");
+
+        TierState state{};
+        state.memory = tier.memory;
+        state.base = tier.base;
+        state.size = memorySize - tier.offset;
+        state.offset = tier.offset;
+        state.bytesPerBurst = memSpec.defaultBytesPerBurst;
+        state.latency = SC_ZERO_TIME;
+        this->tiers.push_back(state);
+    }
+
+    for (auto const &a : this->tiers)
+    {
+        for (auto const &b : this->tiers)
+        {
+            if (&a != &b && a.base < b.base + b.size && b.base < a.base + a.size)
+                SC_REPORT_FATAL("TieredMemory", "Address ranges of memory tiers overlap");
+        }
+    }
+
+    if (migrationEnabled)
+    {
+        if (epoch == SC_ZERO_TIME || counters.empty() || pagesPerEpoch == 0)
+            SC_REPORT_FATAL("TieredMemory",
+                            "Migration requires a non-zero epoch, table size and page count");
+
+        for (auto const &tier : this->tiers)
+        {
+            if (pageSize % tier.bytesPerBurst != 0 || tier.base % pageSize != 0 ||
+                tier.size % pageSize != 0)
+                SC_REPORT_FATAL("TieredMemory",
+                                "Migration page size must divide the burst size and address "
+                                "ranges of all tiers");
+        }
+    }
+
+    for (auto &tier : this->tiers)
+    {
+        for (unsigned int initiator = 0; initiator <= numberOfInitiators; initiator++)
+            iSocket.bind(tier.memory->tSocket);
+    }
+}
+
+uint64_t TieredMemory::getSize() const
+{
+    uint64_t size = 0;
+    for (auto const &tier : tiers)
+        size = std::max(size, tier.base + tier.size);
+
+    return size;
+}
+
+int TieredMemory::connection(unsigned int tier, unsigned int initiator) const
+{
+    return static_cast<int>(tier * (numberOfInitiators + 1) + initiator);
+}
+
+unsigned int TieredMemory::route(uint64_t address, uint64_t &localAddress) const
+{
+    for (unsigned int tier = 0; tier < tiers.size(); tier++)
+    {
+        if (address >= tiers[tier].base && address < tiers[tier].base + tiers[tier].size)
+        {
+            localAddress = address - tiers[tier].base + tiers[tier].offset;
+            return tier;
+        }
+    }
+
+    SC_REPORT_FATAL("TieredMemory", "Address is not mapped to any memory tier");
+    return 0;
+}
+
+tlm_sync_enum TieredMemory::nb_transport_fw(int id,
+                                            tlm_generic_payload &payload,
+                                            tlm_phase &phase,
+                                            sc_time &fwDelay)
+{
+    if (phase == BEGIN_REQ)
+    {
+        uint64_t address = payload.get_address();
+
+        if (migrationEnabled)
+        {
+            if (sc_time_stamp() >= nextEpoch)
+            {
+                migrate();
+                while (nextEpoch <= sc_time_stamp())
+                    nextEpoch += epoch;
+            }
+
+            uint64_t page = address / pageSize;
+            countAccess(page);
+            address = location(page) * pageSize + address % pageSize;
+        }
+
+        uint64_t frame = address / pageSize;
+        if (migrationEnabled)
+            busyFrames[frame]++;
+
+        uint64_t localAddress = 0;
+        unsigned int tier = route(address, localAddress);
+        pendingRequests[&payload] = {tier, payload.get_address(), frame, sc_time_stamp() + fwDelay};
+        payload.set_address(localAddress);
+
+        return iSocket[connection(tier, id)]->nb_transport_fw(payload, phase, fwDelay);
+    }
+
+    auto it = pendingRequests.find(&payload);
+    unsigned int tier = it->second.tier;
+    if (phase == END_RESP)
+    {
+        if (migrationEnabled)
+        {
+            auto busyFrame = busyFrames.find(it->second.frame);
+            if (--busyFrame->second == 0)
+                busyFrames.erase(busyFrame);
+        }
+        pendingRequests.erase(it);
+    }
+
+    return iSocket[connection(tier, id)]->nb_transport_fw(payload, phase, fwDelay);
+}
+
+tlm_sync_enum TieredMemory::nb_transport_bw(int id,
+                                            tlm_generic_payload &payload,
+                                            tlm_phase &phase,
+                                            sc_time &bwDelay)
+{
+    unsigned int tier = static_cast<unsigned int>(id) / (numberOfInitiators + 1);
+    unsigned int initiator = static_cast<unsigned int>(id) % (numberOfInitiators + 1);
+
+    if (initiator == numberOfInitiators)
+    {
+        migrationEventQueue.notify(payload, phase, bwDelay);
+        return TLM_ACCEPTED;
+    }
+
+    if (phase == BEGIN_RESP)
+    {
+        PendingRequest const &request = pendingRequests.at(&payload);
+        tiers[tier].requests++;
+        tiers[tier].bytes += payload.get_data_length();
+        tiers[tier].latency += sc_time_stamp() + bwDelay - request.start;
+        payload.set_address(request.address);
+    }
+
+    return tSocket[static_cast<int>(initiator)]->nb_transport_bw(payload, phase, bwDelay);
+}
+
+void TieredMemory::countAccess(uint64_t page)
+{
+    Counter &counter = counters[(page * 0x9E3779B97F4A7C15ULL >> 16) % counters.size()];
+
+    if (counter.page == page)
+        counter.count++;
+    else if (counter.count == 0)
+        counter = {page, 1};
+    else
+        counter.count--;
+}
+
+uint32_t TieredMemory::accessCount(uint64_t page) const
+{
+    Counter const &counter = counters[(page * 0x9E3779B97F4A7C15ULL >> 16) % counters.size()];
+    return counter.page == page ? counter.count : 0;
+}
+
+uint64_t TieredMemory::location(uint64_t page) const
+{
+    auto it = locations.find(page);
+    return it != locations.end() ? it->second : page;
+}
+
+uint64_t TieredMemory::owner(uint64_t frame) const
+{
+    auto it = owners.find(frame);
+    return it != owners.end() ? it->second : frame;
+}
+
+void TieredMemory::migrate()
+{
+    uint64_t fastFrames = tiers[0].size / pageSize;
+
+    std::vector<Counter> candidates;
+    for (auto const &counter : counters)
+    {
+        if (counter.page != UINT64_MAX && counter.count >= threshold &&
+            location(counter.page) >= fastFrames && !isFrameBusy(location(counter.page)))
+            candidates.push_back(counter);
+    }
+
+    std::sort(candidates.begin(),
+              candidates.end(),
+              [](Counter const &a, Counter const &b) { return a.count > b.count; });
+
+    unsigned int migratedPages = 0;
+    for (auto const &candidate : candidates)
+    {
+        if (migratedPages == pagesPerEpoch)
+            break;
+
+        // Clock sweep over the first tier for a page that is not hot itself
+        std::optional<uint64_t> victimFrame;
+        for (uint64_t step = 0; step < fastFrames; step++)
+        {
+            uint64_t frame = clockHand;
+            clockHand = (clockHand + 1) % fastFrames;
+
+            if (accessCount(owner(frame)) < threshold && !isFrameBusy(frame))
+            {
+                victimFrame = frame;
+                break;
+            }
+        }
+
+        if (!victimFrame)
+            break;
+
+        swapPages(candidate.page, *victimFrame);
+        migratedPages++;
+    }
+
+    for (auto &counter : counters)
+        counter.count /= 2;
+}
+
+bool TieredMemory::isFrameBusy(uint64_t frame) const
+{
+    return busyFrames.find(frame) != busyFrames.end();
+}
+
+void TieredMemory::swapPages(uint64_t hotPage, uint64_t victimFrame)
+{
+    uint64_t hotFrame = location(hotPage);
+    uint64_t victimPage = owner(victimFrame);
+
+    if (storageEnabled)
+    {
+        std::vector<unsigned char> hotData(pageSize);
+        std::vector<unsigned char> victimData(pageSize);
+        copyPage(hotFrame, hotFrame, hotData, false);
+        copyPage(victimFrame, victimFrame, victimData, false);
+        copyPage(hotFrame, victimFrame, hotData, true);
+        copyPage(victimFrame, hotFrame, victimData, true);
+    }
+
+    auto remap = [this](uint64_t page, uint64_t frame)
+    {
+        if (page == frame)
+        {
+            locations.erase(page);
+            owners.erase(frame);
+        }
+        else
+        {
+            locations[page] = frame;
+            owners[frame] = page;
+        }
+    };
+    remap(hotPage, victimFrame);
+    remap(victimPage, hotFrame);
+
+    uint64_t localAddress = 0;
+    unsigned int slowTier = route(hotFrame * pageSize, localAddress);
+    tiers[0].promotedPages++;
+    tiers[slowTier].demotedPages++;
+
+    // Timing: both pages are read from and written to the respective other tier
+    for (auto [fromFrame, toFrame] : {std::pair(hotFrame, victimFrame), std::pair(victimFrame, hotFrame)})
+    {
+        uint64_t fromAddress = 0;
+        uint64_t toAddress = 0;
+        unsigned int fromTier = route(fromFrame * pageSize, fromAddress);
+        unsigned int toTier = route(toFrame * pageSize, toAddress);
+
+        for (uint64_t offset = 0; offset < pageSize; offset += tiers[fromTier].bytesPerBurst)
+            tiers[fromTier].migrationQueue.emplace_back(fromAddress + offset, TLM_READ_COMMAND);
+
+        for (uint64_t offset = 0; offset < pageSize; offset += tiers[toTier].bytesPerBurst)
+            tiers[toTier].migrationQueue.emplace_back(toAddress + offset, TLM_WRITE_COMMAND);
+
+        tiers[fromTier].migrationBytes += pageSize;
+        tiers[toTier].migrationBytes += pageSize;
+    }
+
+    for (unsigned int tier = 0; tier < tiers.size(); tier++)
+        sendMigrationRequest(tier);
+}
+
+void TieredMemory::copyPage(uint64_t fromFrame,
+                            uint64_t toFrame,
+                            std::vector<unsigned char> &buffer,
+                            bool write)
+{
+    uint64_t frame = write ? toFrame : fromFrame;
+    uint64_t localAddress = 0;
+    unsigned int tier = route(frame * pageSize, localAddress);
+    unsigned int bytesPerBurst = tiers[tier].bytesPerBurst;
+
+    // Bursts are accessed individually as the page may be interleaved over several channels
+    for (uint64_t offset = 0; offset < pageSize; offset += bytesPerBurst)
+    {
+        tlm_generic_payload payload;
+        payload.set_command(write ? TLM_WRITE_COMMAND : TLM_READ_COMMAND);
+        payload.set_address(localAddress + offset);
+        payload.set_data_ptr(buffer.data() + offset);
+        payload.set_data_length(bytesPerBurst);
+        payload.set_streaming_width(bytesPerBurst);
+        iSocket[connection(tier, numberOfInitiators)]->transport_dbg(payload);
+    }
+}
+
+void TieredMemory::sendMigrationRequest(unsigned int tier)
+{
+    TierState &state = tiers[tier];
+    if (state.migrationRequestInProgress || state.migrationQueue.empty())
+        return;
+
+    auto [address, command] = state.migrationQueue.front();
+    state.migrationQueue.pop_front();
+
+    tlm_generic_payload &payload = memoryManager.allocate(state.bytesPerBurst);
+    payload.acquire();
+    payload.set_address(address);
+    payload.set_response_status(TLM_INCOMPLETE_RESPONSE);
+    payload.set_dmi_allowed(false);
+    payload.set_byte_enable_length(0);
+    payload.set_data_length(state.bytesPerBurst);
+    payload.set_streaming_width(state.bytesPerBurst);
+    payload.set_command(command);
+
+    // The functional copy has already taken place, write back what the memory now holds
+    if (storageEnabled && command == TLM_WRITE_COMMAND)
+    {
+        tlm_generic_payload debugPayload;
+        debugPayload.set_command(TLM_READ_COMMAND);
+        debugPayload.set_address(address);
+        debugPayload.set_data_ptr(payload.get_data_ptr());
+        debugPayload.set_data_length(state.bytesPerBurst);
+        debugPayload.set_streaming_width(state.bytesPerBurst);
+        iSocket[connection(tier, numberOfInitiators)]->transport_dbg(debugPayload);
+    }
+
+    migrationRequests[&payload] = tier;
+    state.migrationRequestInProgress = true;
+
+    tlm_phase phase = BEGIN_REQ;
+    sc_time delay = SC_ZERO_TIME;
+    iSocket[connection(tier, numberOfInitiators)]->nb_transport_fw(payload, phase, delay);
+}
+
+void TieredMemory::migrationCallback(tlm_generic_payload &payload, const tlm_phase &phase)
+{
+    unsigned int tier = migrationRequests.at(&payload);
+
+    if (phase == END_REQ)
+    {
+        tiers[tier].migrationRequestInProgress = false;
+        sendMigrationRequest(tier);
+    }
+    else if (phase == BEGIN_RESP)
+    {
+        tlm_phase endPhase = END_RESP;
+        sc_time delay = SC_ZERO_TIME;
+        iSocket[connection(tier, numberOfInitiators)]->nb_transport_fw(payload, endPhase, delay);
+
+        migrationRequests.erase(&payload);
+        payload.release();
+    }
+}
+
+void TieredMemory::end_of_simulation()
+{
+    double simulationTime = sc_time_stamp().to_seconds();
+
+    for (auto const &tier : tiers)
+    {
+        double bandwidth =
+            simulationTime > 0 ? static_cast<double>(tier.bytes) / simulationTime / 1e9 : 0;
+        sc_time averageLatency =
+            tier.requests > 0 ? tier.latency / static_cast<double>(tier.requests) : SC_ZERO_TIME;
+
+        std::cout << name() << std::string("  ") << tier.memory->name() << std::string(": ")
+                  << tier.requests << std::string(" requests, ") << std::fixed
+                  << std::setprecision(3) << bandwidth << std::string(" GB/s, average latency ")
+                  << averageLatency << std::endl;
+
+        if (migrationEnabled)
+        {
+            std::cout << name() << std::string("  ") << tier.memory->name()
+                      << std::string(": ") << tier.promotedPages
+                      << std::string(" pages promoted, ") << tier.demotedPages
+                      << std::string(" pages demoted, ") << tier.migrationBytes
+                      << std::string(" bytes migration traffic") << std::endl;
+        }
+    }
+}
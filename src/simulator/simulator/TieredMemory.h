@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+
+#pragma once
+
+#include "simulator/MemoryManager.h"
+
+#include <DRAMSys/simulation/DRAMSys.h>
+
+#include <systemc>
+#include <tlm>
+#include <tlm_utils/multi_passthrough_initiator_socket.h>
+#include <tlm_utils/multi_passthrough_target_socket.h>
+#include <tlm_utils/peq_with_cb_and_phase.h>
+
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// Routes the requests of all initiators to several DRAMSys memory subsystems by address range.
+// Optionally, frequently accessed pages of the other tiers are swapped with cold pages of the
+// first (fast) tier at the end of each epoch; the swap generates read and write traffic on both
+// tiers.
+class TieredMemory : public sc_core::sc_module
+{
+public:
+    struct Tier
+    {
+        DRAMSys::DRAMSys *memory;
+        uint64_t base;
+        uint64_t offset;
+    };
+
+    tlm_utils::multi_passthrough_target_socket<TieredMemory> tSocket;
+
+    TieredMemory(sc_core::sc_module_name const &name,
+                 std::vector<Tier> const &tiers,
+                 std::optional<DRAMSys::Config::TierMigration> const &migration,
+                 unsigned int numberOfInitiators);
+    SC_HAS_PROCESS(TieredMemory);
+
+    // End of the highest address range
+    uint64_t getSize() const;
+
+private:
+    struct TierState
+    {
+        DRAMSys::DRAMSys *memory;
+        uint64_t base;
+        uint64_t size;
+        uint64_t offset;
+        unsigned int bytesPerBurst;
+
+        uint64_t requests = 0;
+        uint64_t bytes = 0;
+        sc_core::sc_time latency;
+        uint64_t promotedPages = 0;
+        uint64_t demotedPages = 0;
+        uint64_t migrationBytes = 0;
+
+        std::deque<std::pair<uint64_t, tlm::tlm_command>> migrationQueue;
+        bool migrationRequestInProgress = false;
+    };
+
+    struct PendingRequest
+    {
+        unsigned int tier;
+        uint64_t address;
+        uint64_t frame;
+        sc_core::sc_time start;
+    };
+
+    // One connection per initiator and tier plus one per tier for the migration traffic
+    tlm_utils::multi_passthrough_initiator_socket<TieredMemory> iSocket;
+    int connection(unsigned int tier, unsigned int initiator) const;
+
+    unsigned int route(uint64_t address, uint64_t &localAddress) const;
+
+    tlm::tlm_sync_enum nb_transport_fw(int id,
+                                       tlm::tlm_generic_payload &payload,
+                                       tlm::tlm_phase &phase,
+                                       sc_core::sc_time &fwDelay);
+    tlm::tlm_sync_enum nb_transport_bw(int id,
+                                       tlm::tlm_generic_payload &payload,
+                                       tlm::tlm_phase &phase,
+                                       sc_core::sc_time &bwDelay);
+
+    void end_of_simulation() override;
+
+    const unsigned int numberOfInitiators;
+    std::vector<TierState> tiers;
+    std::unordered_map<tlm::tlm_generic_payload *, PendingRequest> pendingRequests;
+
+    // Hot page migration
+    struct Counter
+    {
+        uint64_t page = UINT64_MAX;
+        uint32_t count = 0;
+    };
+
+    void countAccess(uint64_t page);
+    uint32_t accessCount(uint64_t page) const;
+    uint64_t location(uint64_t page) const;
+    uint64_t owner(uint64_t frame) const;
+    void migrate();
+    bool isFrameBusy(uint64_t frame) const;
+    void swapPages(uint64_t hotPage, uint64_t victimFrame);
+    void copyPage(uint64_t fromFrame, uint64_t toFrame, std::vector<unsigned char> &buffer, bool write);
+    void sendMigrationRequest(unsigned int tier);
+    void migrationCallback(tlm::tlm_generic_payload &payload, const tlm::tlm_phase &phase);
+
+    const bool migrationEnabled;
+    const sc_core::sc_time epoch;
+    const uint64_t pageSize;
+    const uint32_t threshold;
+    const unsigned int pagesPerEpoch;
+    const bool storageEnabled;
+    sc_core::sc_time nextEpoch;
+    uint64_t clockHand = 0;
+
+    // Bounded table of access counters, a bucket is taken over by another page once its count has
+    // been decremented to zero
+    std::vector<Counter> counters;
+
+    // Swapped pages only: logical page -> frame and frame -> logical page
+    std::unordered_map<uint64_t, uint64_t> locations;
+    std::unordered_map<uint64_t, uint64_t> owners;
+
+    // Number of requests in flight per frame, such frames are not swapped as a request that has
+    // already been routed would access the old location
+    std::unordered_map<uint64_t, unsigned int> busyFrames;
+
+    MemoryManager memoryManager;
+    tlm_utils::peq_with_cb_and_phase<TieredMemory> migrationEventQueue;
+    std::unordered_map<tlm::tlm_generic_payload *, unsigned int> migrationRequests;
+};
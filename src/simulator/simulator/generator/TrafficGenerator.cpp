@@ -35,21 +35,25 @@
 
 #include "TrafficGenerator.h"
 
+#include <algorithm>
+#include <cmath>
+
 TrafficGenerator::TrafficGenerator(DRAMSys::Config::TrafficGeneratorStateMachine const &config,
                                    MemoryManager &memoryManager,
                                    uint64_t memorySize,
                                    unsigned int defaultDataLength,
                                    std::function<void()> transactionFinished,
                                    std::function<void()> terminateInitiator)
-    : consumer(
+    : maxTransactions(config.maxTransactions),
+      consumer(
           config.name.c_str(),
           memoryManager,
           config.maxPendingReadRequests,
           config.maxPendingWriteRequests,
+          config.latencyBudgetNs,
           [this] { return nextRequest(); },
           std::move(transactionFinished),
-          std::move(terminateInitiator)),
-      stateTransistions(config.transitions)
+          std::move(terminateInitiator))
 {
     unsigned int dataLength = config.dataLength.value_or(defaultDataLength);
     unsigned int dataAlignment = config.dataAlignment.value_or(dataLength);
@@ -104,6 +108,9 @@ TrafficGenerator::TrafficGenerator(DRAMSys::Config::TrafficGeneratorStateMachine
             },
             state);
     }
+
+    compileTransitions(config.transitions);
+    requestCount = expectedRequests();
 }
 
 TrafficGenerator::TrafficGenerator(DRAMSys::Config::TrafficGenerator const &config,
@@ -112,11 +119,13 @@ TrafficGenerator::TrafficGenerator(DRAMSys::Config::TrafficGenerator const &conf
                                    unsigned int defaultDataLength,
                                    std::function<void()> transactionFinished,
                                    std::function<void()> terminateInitiator)
-    : consumer(
+    : maxTransactions(config.maxTransactions),
+      consumer(
           config.name.c_str(),
           memoryManager,
           config.maxPendingReadRequests,
           config.maxPendingWriteRequests,
+          config.latencyBudgetNs,
           [this] { return nextRequest(); },
           std::move(transactionFinished),
           std::move(terminateInitiator))
@@ -150,10 +159,15 @@ TrafficGenerator::TrafficGenerator(DRAMSys::Config::TrafficGenerator const &conf
                                                              dataLength);
         producers.emplace(0, std::move(producer));
     }
+
+    requestCount = expectedRequests();
 }
 
 Request TrafficGenerator::nextRequest()
 {
+    if (maxTransactions.has_value() && requestsIssued >= maxTransactions.value())
+        return Request{.command = Request::Command::Stop};
+
     uint64_t clksToIdle = 0;
     if (requestsInState >= producers[currentState]->totalRequests())
     {
@@ -169,12 +183,11 @@ Request TrafficGenerator::nextRequest()
         while (idleStateIt != idleStateClks.cend())
         {
             clksToIdle += idleStateIt->second;
-            newState = stateTransition(currentState);
+            newState = stateTransition(newState.value());
 
             if (!newState.has_value())
                 return Request{.command = Request::Command::Stop};
 
-            currentState = newState.value();
             idleStateIt = idleStateClks.find(newState.value());
         }
 
@@ -183,7 +196,8 @@ Request TrafficGenerator::nextRequest()
     }
 
     requestsInState++;
-    
+    requestsIssued++;
+
     Request request = producers[currentState]->nextRequest();
     request.delay += producers[currentState]->clkPeriod() * clksToIdle;
     return request;
@@ -191,56 +205,51 @@ Request TrafficGenerator::nextRequest()
 
 uint64_t TrafficGenerator::totalRequests()
 {
-    // Store current state of random generator
-    std::default_random_engine tempGenerator(randomGenerator);
-
-    // Reset generator to initial state
-    randomGenerator.seed();
-
-    uint64_t totalRequests = 0;
-    unsigned int currentState = 0;
-
-    if (producers.find(currentState) != producers.cend())
-        totalRequests += producers.at(currentState)->totalRequests();
-
-    while (auto nextState = stateTransition(currentState))
-    {
-        currentState = nextState.value();
-
-        if (producers.find(currentState) != producers.cend())
-            totalRequests += producers.at(currentState)->totalRequests();
-    }
-
-    // Restore state of random generator
-    randomGenerator = tempGenerator;
-
-    return totalRequests;
+    return requestCount;
 }
 
 std::optional<unsigned int> TrafficGenerator::stateTransition(unsigned int from)
 {
-    using Transition = DRAMSys::Config::TrafficGeneratorStateTransition;
+    auto tableIt = transitionTables.find(from);
+    if (tableIt == transitionTables.cend())
+        return std::nullopt;
 
-    std::vector<Transition> relevantTransitions;
-    std::copy_if(stateTransistions.cbegin(),
-                 stateTransistions.cend(),
-                 std::back_inserter(relevantTransitions),
-                 [from](Transition transition) { return transition.from == from; });
+    return tableIt->second.sample(transitionDistribution(randomGenerator));
+}
 
-    if (relevantTransitions.empty())
-        return std::nullopt;
+void TrafficGenerator::compileTransitions(
+    std::vector<DRAMSys::Config::TrafficGeneratorStateTransition> const &transitions)
+{
+    std::unordered_map<unsigned int, std::vector<std::pair<unsigned int, double>>> outgoing;
+    for (auto const &transition : transitions)
+        outgoing[transition.from].emplace_back(transition.to, transition.probability);
 
-    std::vector<double> propabilities;
-    std::for_each(relevantTransitions.cbegin(),
-                  relevantTransitions.cend(),
-                  [&propabilities](Transition transition)
-                  { propabilities.push_back(transition.probability); });
+    for (auto const &[from, edges] : outgoing)
+        transitionTables.emplace(from, TransitionTable(edges));
+}
 
-    assert(propabilities.size() == relevantTransitions.size());
+uint64_t TrafficGenerator::expectedRequests() const
+{
+    // The state machine is an absorbing Markov chain whose absorbing states are the states without
+    // outgoing transitions, every visit of an active state issues its requests
+    auto visits = expectedVisits(transitionTables);
+    if (!visits.has_value())
+    {
+        if (!maxTransactions.has_value())
+            SC_REPORT_FATAL("TrafficGenerator",
+                            "State machine never terminates, maxTransactions has to be specified.");
+
+        return maxTransactions.value();
+    }
 
-    std::discrete_distribution<std::size_t> stateTransitionDistribution(propabilities.cbegin(),
-                                                                        propabilities.cend());
+    double expected = 0.0;
+    for (auto const &[state, stateVisits] : visits.value())
+    {
+        auto producerIt = producers.find(state);
+        if (producerIt != producers.cend())
+            expected += stateVisits * static_cast<double>(producerIt->second->totalRequests());
+    }
 
-    std::size_t index = stateTransitionDistribution(randomGenerator);
-    return relevantTransitions[index].to;
+    auto requests = static_cast<uint64_t>(std::llround(expected));
+    return maxTransactions.has_value() ? std::min(requests, maxTransactions.value()) : requests;
 }
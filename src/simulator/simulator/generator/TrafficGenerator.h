@@ -37,6 +37,7 @@
 
 #include "RandomProducer.h"
 #include "SequentialProducer.h"
+#include "TransitionTable.h"
 #include "simulator/Initiator.h"
 #include "simulator/MemoryManager.h"
 #include "simulator/request/RequestIssuer.h"
@@ -68,9 +69,18 @@ public:
     std::optional<unsigned int> stateTransition(unsigned int from);
 
 private:
+    void compileTransitions(
+        std::vector<DRAMSys::Config::TrafficGeneratorStateTransition> const &transitions);
+    uint64_t expectedRequests() const;
+
     uint64_t requestsInState = 0;
+    uint64_t requestsIssued = 0;
     unsigned int currentState = 0;
-    const std::vector<DRAMSys::Config::TrafficGeneratorStateTransition> stateTransistions;
+    const std::optional<uint64_t> maxTransactions;
+    uint64_t requestCount = 0;
+
+    std::unordered_map<unsigned int, TransitionTable> transitionTables;
+    std::uniform_real_distribution<double> transitionDistribution{0.0, 1.0};
 
     using IdleClks = uint64_t;
     std::unordered_map<unsigned int, IdleClks> idleStateClks;
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+#include "TransitionTable.h"
+
+#include <systemc>
+
+#include <algorithm>
+#include <cmath>
+
+TransitionTable::TransitionTable(std::vector<std::pair<unsigned int, double>> const &transitions)
+{
+    double sum = 0.0;
+    for (auto const &transition : transitions)
+        sum += transition.second;
+
+    if (sum <= 0.0)
+        SC_REPORT_FATAL("TrafficGenerator", "Transition probabilities of a state sum up to zero.");
+
+    std::size_t size = transitions.size();
+    targets.resize(size);
+    threshold.resize(size);
+    alias.resize(size);
+
+    std::vector<double> scaled(size);
+    std::vector<std::size_t> small;
+    std::vector<std::size_t> large;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        targets[i] = transitions[i].first;
+        scaled[i] = transitions[i].second / sum * static_cast<double>(size);
+        alias[i] = i;
+        (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        std::size_t less = small.back();
+        small.pop_back();
+        std::size_t more = large.back();
+
+        threshold[less] = scaled[less];
+        alias[less] = more;
+
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+        if (scaled[more] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // Remaining entries are 1.0 up to rounding errors
+    for (std::size_t i : small)
+        threshold[i] = 1.0;
+    for (std::size_t i : large)
+        threshold[i] = 1.0;
+}
+
+unsigned int TransitionTable::sample(double uniform) const
+{
+    // A single uniform number selects the column (integer part) and decides between the column
+    // and its alias (fractional part)
+    double scaled = uniform * static_cast<double>(targets.size());
+    auto column = std::min(static_cast<std::size_t>(scaled), targets.size() - 1);
+    double fraction = scaled - static_cast<double>(column);
+
+    return fraction < threshold[column] ? targets[column] : targets[alias[column]];
+}
+
+std::vector<std::pair<unsigned int, double>> TransitionTable::probabilities() const
+{
+    std::vector<std::pair<unsigned int, double>> result;
+    double columnProbability = 1.0 / static_cast<double>(targets.size());
+    for (std::size_t column = 0; column < targets.size(); column++)
+    {
+        if (threshold[column] > 0.0)
+            result.emplace_back(targets[column], columnProbability * threshold[column]);
+        if (threshold[column] < 1.0)
+            result.emplace_back(targets[alias[column]], columnProbability * (1.0 - threshold[column]));
+    }
+    return result;
+}
+
+std::optional<std::unordered_map<unsigned int, double>>
+expectedVisits(std::unordered_map<unsigned int, TransitionTable> const &transitionTables)
+{
+    // The expected number of visits v of the states reachable from the initial state solves
+    // v = e_0 + P^T v. Only transitions with a positive probability are edges of the chain.
+    std::vector<unsigned int> states{0};
+    std::unordered_map<unsigned int, std::size_t> index{{0, 0}};
+    for (std::size_t i = 0; i < states.size(); i++)
+    {
+        auto tableIt = transitionTables.find(states[i]);
+        if (tableIt == transitionTables.cend())
+            continue;
+
+        for (auto const &[to, probability] : tableIt->second.probabilities())
+        {
+            if (probability > 0.0 && index.emplace(to, states.size()).second)
+                states.push_back(to);
+        }
+    }
+
+    // Dense system (I - P^T) v = e_0 and the predecessors of each state
+    std::size_t size = states.size();
+    std::vector<std::vector<double>> matrix(size, std::vector<double>(size, 0.0));
+    std::vector<std::vector<std::size_t>> predecessors(size);
+    std::vector<bool> absorbing(size, true);
+    for (std::size_t from = 0; from < size; from++)
+    {
+        matrix[from][from] = 1.0;
+
+        auto tableIt = transitionTables.find(states[from]);
+        if (tableIt == transitionTables.cend())
+            continue;
+
+        absorbing[from] = false;
+
+        for (auto const &[target, probability] : tableIt->second.probabilities())
+        {
+            if (probability <= 0.0)
+                continue;
+
+            std::size_t to = index.at(target);
+            matrix[to][from] -= probability;
+            predecessors[to].push_back(from);
+        }
+    }
+
+    // The chain terminates if an absorbing state can be reached from every reachable state
+    std::vector<bool> terminating = absorbing;
+    std::vector<std::size_t> pending;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (absorbing[i])
+            pending.push_back(i);
+    }
+    while (!pending.empty())
+    {
+        std::size_t state = pending.back();
+        pending.pop_back();
+        for (std::size_t predecessor : predecessors[state])
+        {
+            if (!terminating[predecessor])
+            {
+                terminating[predecessor] = true;
+                pending.push_back(predecessor);
+            }
+        }
+    }
+
+    if (std::find(terminating.cbegin(), terminating.cend(), false) != terminating.cend())
+        return std::nullopt;
+
+    // Gaussian elimination with partial pivoting, I - P^T is regular because the chain is
+    // absorbing
+    std::vector<double> visits(size, 0.0);
+    visits[0] = 1.0;
+    for (std::size_t column = 0; column < size; column++)
+    {
+        std::size_t pivot = column;
+        for (std::size_t row = column + 1; row < size; row++)
+        {
+            if (std::abs(matrix[row][column]) > std::abs(matrix[pivot][column]))
+                pivot = row;
+        }
+        std::swap(matrix[column], matrix[pivot]);
+        std::swap(visits[column], visits[pivot]);
+
+        for (std::size_t row = column + 1; row < size; row++)
+        {
+            double factor = matrix[row][column] / matrix[column][column];
+            if (factor == 0.0)
+                continue;
+
+            for (std::size_t i = column; i < size; i++)
+                matrix[row][i] -= factor * matrix[column][i];
+            visits[row] -= factor * visits[column];
+        }
+    }
+
+    for (std::size_t row = size; row-- > 0;)
+    {
+        for (std::size_t i = row + 1; i < size; i++)
+            visits[row] -= matrix[row][i] * visits[i];
+        visits[row] /= matrix[row][row];
+    }
+
+    std::unordered_map<unsigned int, double> result;
+    for (std::size_t i = 0; i < size; i++)
+        result.emplace(states[i], visits[i]);
+    return result;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Transitions of one state compiled into an alias table (Vose) for constant time sampling
+class TransitionTable
+{
+public:
+    // The probabilities are normalized to their sum, which has to be positive
+    explicit TransitionTable(std::vector<std::pair<unsigned int, double>> const &transitions);
+
+    // Maps a uniformly distributed number in [0, 1) to the target state
+    [[nodiscard]] unsigned int sample(double uniform) const;
+
+    // Transition probabilities recovered from the table, a target can occur more than once
+    [[nodiscard]] std::vector<std::pair<unsigned int, double>> probabilities() const;
+
+private:
+    std::vector<unsigned int> targets;
+    std::vector<double> threshold;
+    std::vector<std::size_t> alias;
+};
+
+// Expected number of visits of each state reachable from state 0 of the absorbing Markov chain
+// given by the transition tables, states without a table are absorbing. Returns std::nullopt if
+// some reachable state cannot reach an absorbing state, i.e., the chain may never terminate.
+std::optional<std::unordered_map<unsigned int, double>>
+expectedVisits(std::unordered_map<unsigned int, TransitionTable> const &transitionTables);
@@ -35,10 +35,13 @@
 
 #include "RequestIssuer.h"
 
+#include "DRAMSys/common/dramExtensions.h"
+
 RequestIssuer::RequestIssuer(sc_core::sc_module_name const &name,
                              MemoryManager &memoryManager,
                              std::optional<unsigned int> maxPendingReadRequests,
                              std::optional<unsigned int> maxPendingWriteRequests,
+                             std::optional<unsigned int> latencyBudgetNs,
                              std::function<Request()> nextRequest,
                              std::function<void()> transactionFinished,
                              std::function<void()> terminate)
@@ -46,6 +49,9 @@ RequestIssuer::RequestIssuer(sc_core::sc_module_name const &name,
       memoryManager(memoryManager),
       maxPendingReadRequests(maxPendingReadRequests),
       maxPendingWriteRequests(maxPendingWriteRequests),
+      latencyBudget(latencyBudgetNs.has_value()
+                        ? std::optional(sc_core::sc_time(*latencyBudgetNs, sc_core::SC_NS))
+                        : std::nullopt),
       nextRequest(std::move(nextRequest)),
       transactionFinished(std::move(transactionFinished)),
       terminate(std::move(terminate)),
@@ -79,6 +85,13 @@ void RequestIssuer::sendNextRequest()
     tlm::tlm_phase phase = tlm::BEGIN_REQ;
     sc_core::sc_time delay = request.delay;
 
+    // Payloads are shared between initiators, a deadline left over from a previous use is cleared
+    if (latencyBudget.has_value())
+        DRAMSys::DeadlineExtension::setAutoExtension(
+            payload, sc_core::sc_time_stamp() + delay + *latencyBudget);
+    else if (payload.get_extension<DRAMSys::DeadlineExtension>() != nullptr)
+        DRAMSys::DeadlineExtension::setAutoExtension(payload, sc_core::sc_max_time());
+
     if (request.address == 0x4000f000)
         int x = 0;
 
@@ -54,6 +54,7 @@ public:
                   MemoryManager &memoryManager,
                   std::optional<unsigned int> maxPendingReadRequests,
                   std::optional<unsigned int> maxPendingWriteRequests,
+                  std::optional<unsigned int> latencyBudgetNs,
                   std::function<Request()> nextRequest,
                   std::function<void()> transactionFinished,
                   std::function<void()> terminate);
@@ -75,6 +76,9 @@ private:
     const std::optional<unsigned int> maxPendingReadRequests;
     const std::optional<unsigned int> maxPendingWriteRequests;
 
+    // Requests are sent with a DeadlineExtension of their issue time plus the latency budget
+    const std::optional<sc_core::sc_time> latencyBudget;
+
     unsigned int activeProducers = 0;
 
     std::function<void()> transactionFinished;
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef STLTRACE_H
+#define STLTRACE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+// Helpers shared by the offline trace tools
+
+// Bounded queue between the thread that reads a trace and one worker thread, push blocks while
+// the queue is full
+template <typename T, std::size_t Capacity>
+class BoundedQueue
+{
+public:
+    void push(T&& item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return items.size() < Capacity; });
+        items.emplace_back(std::move(item));
+        notEmpty.notify_one();
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notEmpty.notify_one();
+    }
+
+    // Returns false once the queue is closed and empty
+    bool pop(T& item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return !items.empty() || closed; });
+        if (items.empty())
+            return false;
+
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::deque<T> items;
+    bool closed = false;
+};
+
+struct StlRecord
+{
+    uint64_t time = 0;
+    std::optional<uint64_t> length;
+    bool isRead = false;
+    uint64_t address = 0;
+    std::size_t colon = 0; // Position of the colon after the time in the line
+};
+
+// Empty lines and comments carry no request
+inline bool isStlComment(const std::string& line)
+{
+    return line.size() <= 1 || line[0] == '#';
+}
+
+// Parses "<time>: [(<length>)] read|write <address> [<data>]", std::nullopt if the line is malformed
+inline std::optional<StlRecord> parseStlRecord(const std::string& line)
+{
+    StlRecord record;
+    const char* position = line.c_str();
+    char* end = nullptr;
+    record.time = std::strtoull(position, &end, 10);
+    record.colon = line.find(':');
+    if (end == position || record.colon == std::string::npos)
+        return std::nullopt;
+
+    position = line.c_str() + record.colon + 1;
+    while (*position == ' ' || *position == '\t')
+        position++;
+
+    if (*position == '(')
+    {
+        const char* lengthStart = position + 1;
+        record.length = std::strtoull(lengthStart, &end, 10);
+        position = std::strchr(end, ')');
+        if (end == lengthStart || position == nullptr)
+            return std::nullopt;
+
+        position++;
+        while (*position == ' ' || *position == '\t')
+            position++;
+    }
+
+    record.isRead = std::strncmp(position, "read", 4) == 0;
+    if (!record.isRead && std::strncmp(position, "write", 5) != 0)
+        return std::nullopt;
+
+    position += record.isRead ? 4 : 5;
+    record.address = std::strtoull(position, &end, 16);
+    if (end == position)
+        return std::nullopt;
+
+    return record;
+}
+
+#endif // STLTRACE_H
@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <DRAMSys/util/json.h>
+
+#include <sqlite3.h>
+#include <systemc>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Extracts statistics from the channel databases written by DRAMSysRecordable. Every database is
+// read by its own thread with a single sequential scan over each of the tables GeneralInfo,
+// Transactions, Phases and Power.
+
+namespace
+{
+
+constexpr uint64_t NO_TIME = UINT64_MAX;
+constexpr double PERCENTILES[] = {50.0, 90.0, 99.0, 99.9};
+
+struct Interval
+{
+    uint64_t begin;
+    uint64_t end;
+};
+
+struct TransactionInfo
+{
+    uint64_t dataLength = 0;
+    uint32_t thread = 0;
+    uint64_t request = NO_TIME;
+};
+
+struct LatencyStatistics
+{
+    uint64_t count = 0;
+    double average = 0.0;
+    uint64_t maximum = 0;
+    std::vector<uint64_t> percentiles;
+};
+
+struct ChannelResult
+{
+    std::filesystem::path path;
+    std::string error;
+
+    uint64_t clk = 0;
+    uint64_t traceEnd = 0;
+    uint64_t windowSize = 0;
+    uint64_t transactions = 0;
+    uint64_t bytes = 0;
+    std::map<std::string, uint64_t> commandCounts;
+    std::map<uint32_t, LatencyStatistics> threadLatencies;
+    std::vector<double> bankUtilization;
+    std::vector<uint64_t> windowBytes;
+    std::vector<uint64_t> windowDataBusBusy;
+    std::vector<std::pair<double, double>> power; // time in s, power in W
+    double averagePower = 0.0;                    // W
+};
+
+class Database
+{
+public:
+    explicit Database(const std::filesystem::path& path)
+    {
+        if (sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK)
+        {
+            error = sqlite3_errmsg(db);
+            return;
+        }
+
+        // Large page cache and memory mapped I/O, the tables are only scanned sequentially
+        sqlite3_exec(db,
+                     "PRAGMA query_only = 1; PRAGMA cache_size = -262144; "
+                     "PRAGMA mmap_size = 4294967296; PRAGMA temp_store = MEMORY;",
+                     nullptr, nullptr, nullptr);
+    }
+
+    ~Database()
+    {
+        sqlite3_close(db);
+    }
+
+    Database(const Database&) = delete;
+    Database& operator=(const Database&) = delete;
+
+    // Calls function for every row of query, returns false if the query fails
+    template <typename Function>
+    bool query(const char* sql, Function&& function)
+    {
+        sqlite3_stmt* statement = nullptr;
+        if (sqlite3_prepare_v2(db, sql, -1, &statement, nullptr) != SQLITE_OK)
+        {
+            error = sqlite3_errmsg(db);
+            return false;
+        }
+
+        int result;
+        while ((result = sqlite3_step(statement)) == SQLITE_ROW)
+            function(statement);
+
+        if (result != SQLITE_DONE)
+            error = sqlite3_errmsg(db);
+        sqlite3_finalize(statement);
+        return result == SQLITE_DONE;
+    }
+
+    std::string error;
+
+private:
+    sqlite3* db = nullptr;
+};
+
+uint64_t columnTime(sqlite3_stmt* statement, int column)
+{
+    return static_cast<uint64_t>(std::max<sqlite3_int64>(sqlite3_column_int64(statement, column), 0));
+}
+
+// Adds the part of interval that falls into each window to the window
+void addToWindows(std::vector<uint64_t>& windows, uint64_t windowSize, Interval interval)
+{
+    while (interval.begin < interval.end)
+    {
+        std::size_t window = interval.begin / windowSize;
+        uint64_t windowEnd = (window + 1) * windowSize;
+        if (window >= windows.size())
+            windows.resize(window + 1, 0);
+        windows[window] += std::min(interval.end, windowEnd) - interval.begin;
+        interval.begin = windowEnd;
+    }
+}
+
+// Length of the union of the intervals
+uint64_t busyTime(std::vector<Interval>& intervals)
+{
+    std::sort(intervals.begin(), intervals.end(),
+              [](const Interval& a, const Interval& b) { return a.begin < b.begin; });
+
+    uint64_t busy = 0;
+    uint64_t coveredUntil = 0;
+    for (const auto& interval : intervals)
+    {
+        uint64_t begin = std::max(interval.begin, coveredUntil);
+        if (interval.end > begin)
+        {
+            busy += interval.end - begin;
+            coveredUntil = interval.end;
+        }
+    }
+    return busy;
+}
+
+bool isBankCommand(const std::string& name)
+{
+    static const char* const bankCommands[] = {"ACT", "RD", "RDA", "WR", "WRA", "PREPB", "REFPB", "RFMPB",
+                                               "REFP2B", "RFMP2B", "PRESB", "REFSB", "RFMSB"};
+    return std::any_of(std::begin(bankCommands), std::end(bankCommands),
+                       [&](const char* command) { return name == command; });
+}
+
+void analyze(ChannelResult& result, uint64_t windowSizeOverride)
+{
+    Database db(result.path);
+
+    unsigned numberOfBanks = 0;
+    bool success = db.error.empty() && db.query(
+        "SELECT clk, TraceEnd, NumberOfBanks, WindowSize FROM GeneralInfo",
+        [&](sqlite3_stmt* statement)
+        {
+            result.clk = columnTime(statement, 0);
+            result.traceEnd = columnTime(statement, 1);
+            numberOfBanks = static_cast<unsigned>(sqlite3_column_int(statement, 2));
+            result.windowSize = columnTime(statement, 3);
+        });
+
+    if (windowSizeOverride != 0)
+        result.windowSize = windowSizeOverride;
+    if (result.windowSize == 0)
+        result.windowSize = 1000000; // 1 us
+
+    std::vector<TransactionInfo> transactions;
+    success = success && db.query(
+        "SELECT ID, DataLength, Thread FROM Transactions",
+        [&](sqlite3_stmt* statement)
+        {
+            auto id = static_cast<std::size_t>(sqlite3_column_int64(statement, 0));
+            if (id >= transactions.size())
+                transactions.resize(std::max(id + 1, transactions.size() * 2));
+            transactions[id].dataLength = columnTime(statement, 1);
+            transactions[id].thread = static_cast<uint32_t>(sqlite3_column_int(statement, 2));
+            result.transactions++;
+        });
+
+    // Phase names repeat for every row, they are counted by index into a short list
+    std::vector<std::string> phaseNames;
+    std::vector<uint64_t> phaseCounts;
+    std::vector<bool> phaseIsBankCommand;
+    std::map<uint32_t, std::vector<uint64_t>> latencies;
+    std::vector<std::vector<Interval>> bankIntervals(numberOfBanks);
+    int requestIndex = -1;
+    int responseIndex = -1;
+
+    success = success && db.query(
+        "SELECT PhaseName, PhaseBegin, PhaseEnd, DataStrobeBegin, DataStrobeEnd, Bank, Transact FROM Phases",
+        [&](sqlite3_stmt* statement)
+        {
+            const char* name = reinterpret_cast<const char*>(sqlite3_column_text(statement, 0));
+            if (name == nullptr)
+                return;
+
+            std::size_t index = 0;
+            while (index < phaseNames.size() && phaseNames[index] != name)
+                index++;
+            if (index == phaseNames.size())
+            {
+                phaseNames.emplace_back(name);
+                phaseCounts.push_back(0);
+                phaseIsBankCommand.push_back(isBankCommand(phaseNames.back()));
+                if (phaseNames.back() == "REQ")
+                    requestIndex = static_cast<int>(index);
+                else if (phaseNames.back() == "RESP")
+                    responseIndex = static_cast<int>(index);
+            }
+            phaseCounts[index]++;
+
+            uint64_t begin = columnTime(statement, 1);
+            uint64_t end = columnTime(statement, 2);
+            auto id = static_cast<std::size_t>(sqlite3_column_int64(statement, 6));
+
+            if (static_cast<int>(index) == requestIndex)
+            {
+                if (id < transactions.size())
+                    transactions[id].request = begin;
+            }
+            else if (static_cast<int>(index) == responseIndex)
+            {
+                if (id < transactions.size() && transactions[id].request != NO_TIME)
+                {
+                    const TransactionInfo& transaction = transactions[id];
+                    latencies[transaction.thread].push_back(begin - std::min(begin, transaction.request));
+                    result.bytes += transaction.dataLength;
+                    std::size_t window = begin / result.windowSize;
+                    if (window >= result.windowBytes.size())
+                        result.windowBytes.resize(window + 1, 0);
+                    result.windowBytes[window] += transaction.dataLength;
+                }
+            }
+            else
+            {
+                uint64_t strobeBegin = columnTime(statement, 3);
+                uint64_t strobeEnd = columnTime(statement, 4);
+                if (strobeEnd > strobeBegin)
+                    addToWindows(result.windowDataBusBusy, result.windowSize, {strobeBegin, strobeEnd});
+
+                auto bank = static_cast<unsigned>(sqlite3_column_int(statement, 5));
+                if (phaseIsBankCommand[index] && bank < numberOfBanks)
+                    bankIntervals[bank].push_back({begin, end});
+            }
+        });
+
+    success = success && db.query(
+        "SELECT time, AveragePower FROM Power ORDER BY rowid",
+        [&](sqlite3_stmt* statement)
+        {
+            // The recorder stores the power in mW
+            result.power.emplace_back(sqlite3_column_double(statement, 0),
+                                      sqlite3_column_double(statement, 1) / 1000.0);
+        });
+
+    if (!success)
+    {
+        result.error = db.error;
+        return;
+    }
+
+    for (std::size_t index = 0; index < phaseNames.size(); index++)
+    {
+        if (static_cast<int>(index) != requestIndex && static_cast<int>(index) != responseIndex)
+            result.commandCounts[phaseNames[index]] = phaseCounts[index];
+    }
+
+    for (auto& [thread, values] : latencies)
+    {
+        LatencyStatistics& statistics = result.threadLatencies[thread];
+        statistics.count = values.size();
+        double sum = 0.0;
+        for (uint64_t value : values)
+            sum += static_cast<double>(value);
+        statistics.average = sum / static_cast<double>(values.size());
+        statistics.maximum = *std::max_element(values.begin(), values.end());
+
+        // Nearest rank percentiles, nth_element on the remaining upper part keeps this linear
+        auto lower = values.begin();
+        for (double percentile : PERCENTILES)
+        {
+            auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(values.size())));
+            auto position = values.begin() + static_cast<std::ptrdiff_t>(std::max<std::size_t>(rank, 1) - 1);
+            std::nth_element(lower, position, values.end());
+            statistics.percentiles.push_back(*position);
+            lower = position;
+        }
+        std::vector<uint64_t>().swap(values);
+    }
+
+    uint64_t simulationTime = std::max<uint64_t>(result.traceEnd, 1);
+    for (auto& intervals : bankIntervals)
+        result.bankUtilization.push_back(static_cast<double>(busyTime(intervals)) / static_cast<double>(simulationTime));
+
+    // The last record is the average over the whole simulation written at its end, the records before
+    // are the power windows (if power windowing was enabled)
+    if (!result.power.empty())
+    {
+        result.averagePower = result.power.back().second;
+        result.power.pop_back();
+    }
+    if (!result.power.empty())
+    {
+        double sum = 0.0;
+        for (const auto& sample : result.power)
+            sum += sample.second;
+        result.averagePower = sum / static_cast<double>(result.power.size());
+    }
+}
+
+// Bytes per picosecond to GB/s
+double toGigabytesPerSecond(uint64_t bytes, uint64_t picoseconds)
+{
+    return picoseconds == 0 ? 0.0 : static_cast<double>(bytes) / static_cast<double>(picoseconds) * 1000.0;
+}
+
+std::string percentileName(double percentile)
+{
+    std::ostringstream stream;
+    stream << "p" << percentile;
+    return stream.str();
+}
+
+} // namespace
+
+int sc_main(int argc, char **argv)
+{
+    uint64_t windowSize = 0;
+    std::string prefix = "tdbstats";
+    std::vector<ChannelResult> results;
+
+    for (int argument = 1; argument < argc; argument++)
+    {
+        if (std::strcmp(argv[argument], "-w") == 0 && argument + 1 < argc)
+            windowSize = static_cast<uint64_t>(std::stod(argv[++argument]) * 1000.0);
+        else if (std::strcmp(argv[argument], "-o") == 0 && argument + 1 < argc)
+            prefix = argv[++argument];
+        else
+            results.emplace_back().path = argv[argument];
+    }
+
+    if (results.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " [-w <window in ns>] [-o <output prefix>] <channel.tdb>..."
+                  << std::endl;
+        return 1;
+    }
+
+    std::vector<std::thread> readers;
+    for (auto& result : results)
+        readers.emplace_back([&result, windowSize]() { analyze(result, windowSize); });
+    for (auto& reader : readers)
+        reader.join();
+
+    for (const auto& result : results)
+    {
+        if (!result.error.empty())
+        {
+            std::cerr << "Could not read " << result.path << ": " << result.error << std::endl;
+            return 1;
+        }
+    }
+
+    nlohmann::json summary;
+    std::size_t numberOfWindows = 0;
+    for (const auto& result : results)
+    {
+        nlohmann::json channel;
+        channel["file"] = result.path.string();
+        channel["simulationTimePs"] = result.traceEnd;
+        channel["transactions"] = result.transactions;
+        channel["bytes"] = result.bytes;
+        channel["averageBandwidthGBps"] = toGigabytesPerSecond(result.bytes, result.traceEnd);
+        channel["commands"] = result.commandCounts;
+        channel["bankUtilization"] = result.bankUtilization;
+        channel["averagePowerW"] = result.averagePower;
+
+        for (const auto& [thread, statistics] : result.threadLatencies)
+        {
+            nlohmann::json latency;
+            latency["count"] = statistics.count;
+            latency["averagePs"] = statistics.average;
+            latency["maxPs"] = statistics.maximum;
+            for (std::size_t index = 0; index < statistics.percentiles.size(); index++)
+                latency[percentileName(PERCENTILES[index]) + "Ps"] = statistics.percentiles[index];
+            channel["latency"][std::to_string(thread)] = latency;
+        }
+
+        summary["channels"].push_back(channel);
+        numberOfWindows = std::max({numberOfWindows, result.windowBytes.size(), result.windowDataBusBusy.size()});
+    }
+
+    std::ofstream jsonFile(prefix + ".json");
+    jsonFile << summary.dump(4) << std::endl;
+
+    // The channel databases of one simulation share the window size
+    const uint64_t csvWindowSize = results.front().windowSize;
+    std::ofstream bandwidthFile(prefix + "_bandwidth.csv");
+    bandwidthFile << "time_ns";
+    for (std::size_t channel = 0; channel < results.size(); channel++)
+        bandwidthFile << ",bandwidth_gbps_" << channel << ",bus_utilization_" << channel;
+    bandwidthFile << "\n";
+    for (std::size_t window = 0; window < numberOfWindows; window++)
+    {
+        bandwidthFile << static_cast<double>((window + 1) * csvWindowSize) / 1000.0;
+        for (const auto& result : results)
+        {
+            uint64_t bytes = window < result.windowBytes.size() ? result.windowBytes[window] : 0;
+            uint64_t busy = window < result.windowDataBusBusy.size() ? result.windowDataBusBusy[window] : 0;
+            bandwidthFile << "," << toGigabytesPerSecond(bytes, result.windowSize) << ","
+                          << static_cast<double>(busy) / static_cast<double>(result.windowSize);
+        }
+        bandwidthFile << "\n";
+    }
+
+    std::ofstream powerFile(prefix + "_power.csv");
+    powerFile << "channel,time_s,power_w\n";
+    for (std::size_t channel = 0; channel < results.size(); channel++)
+    {
+        for (const auto& [time, power] : results[channel].power)
+            powerFile << channel << "," << time << "," << power << "\n";
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    for (const auto& result : results)
+    {
+        uint64_t requests = 0;
+        double latencySum = 0.0;
+        for (const auto& [thread, statistics] : result.threadLatencies)
+        {
+            requests += statistics.count;
+            latencySum += statistics.average * static_cast<double>(statistics.count);
+        }
+
+        std::cout << result.path.filename().string() << ": " << result.transactions << " transactions, "
+                  << toGigabytesPerSecond(result.bytes, result.traceEnd) << " GB/s, average latency "
+                  << (requests == 0 ? 0.0 : latencySum / static_cast<double>(requests) / 1000.0) << " ns, "
+                  << result.averagePower << " W" << std::endl;
+    }
+    std::cout << "Written " << prefix << ".json, " << prefix << "_bandwidth.csv and " << prefix << "_power.csv"
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <common/StlTrace.h>
+
+#include <DRAMSys/config/DRAMSysConfiguration.h>
+#include <DRAMSys/configuration/Configuration.h>
+#include <DRAMSys/simulation/AddressDecoder.h>
+#include <DRAMSys/util/json.h>
+
+#include <systemc>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Splits an .stl/.rstl trace into shards by channel (AddressDecoder of a DRAMSys configuration),
+// by time slice or round-robin into a number of threads. The trace is read once, the shards are
+// written by a pool of writer threads in large chunks. The shard contents only depend on the
+// trace and the partitioning, not on the number of writer threads.
+
+namespace
+{
+
+constexpr std::size_t BUFFER_SIZE = 1 << 20;
+constexpr std::size_t MAX_QUEUED_BUFFERS = 16;
+
+enum class Mode
+{
+    Channel,
+    Thread,
+    Time
+};
+
+struct Buffer
+{
+    uint64_t shard = 0;
+    std::string data;
+    bool last = false;
+};
+
+using BufferQueue = BoundedQueue<Buffer, MAX_QUEUED_BUFFERS>;
+
+struct Shard
+{
+    uint64_t index = 0;
+    std::string data;
+    uint64_t requests = 0;
+    uint64_t reads = 0;
+    uint64_t writes = 0;
+    uint64_t firstTime = 0;
+    uint64_t lastTime = 0;
+};
+
+} // namespace
+
+int sc_main(int argc, char **argv)
+{
+    if (argc < 5)
+    {
+        std::cerr << "Usage: " << argv[0] << " <config.json> <trace.stl|trace.rstl> <output directory>"
+                  << " channel|thread=<number>|time=<cycles> [resource directory] [threads]" << std::endl;
+        return 1;
+    }
+
+    std::filesystem::path baseConfig = argv[1];
+    std::filesystem::path tracePath = argv[2];
+    std::filesystem::path outputDirectory = argv[3];
+    std::string partitioning = argv[4];
+    std::filesystem::path resourceDirectory = argc >= 6 ? argv[5] : DRAMSYS_RESOURCE_DIR;
+    unsigned numberOfThreads = argc >= 7 ? static_cast<unsigned>(std::stoul(argv[6]))
+                                         : std::max(1U, std::thread::hardware_concurrency());
+
+    Mode mode = Mode::Channel;
+    uint64_t parameter = 0;
+    if (partitioning.rfind("thread=", 0) == 0)
+    {
+        mode = Mode::Thread;
+        parameter = std::strtoull(partitioning.c_str() + 7, nullptr, 10);
+    }
+    else if (partitioning.rfind("time=", 0) == 0)
+    {
+        mode = Mode::Time;
+        parameter = std::strtoull(partitioning.c_str() + 5, nullptr, 10);
+    }
+    else if (partitioning != "channel")
+    {
+        std::cerr << "Unknown partitioning " << partitioning << std::endl;
+        return 1;
+    }
+    if (mode != Mode::Channel && parameter == 0)
+    {
+        std::cerr << "Number of threads and time slice must be at least 1" << std::endl;
+        return 1;
+    }
+
+    DRAMSys::Config::Configuration configuration =
+        DRAMSys::Config::from_path(baseConfig.c_str(), resourceDirectory.c_str());
+
+    DRAMSys::Configuration config;
+    config.loadMemSpec(configuration.memspec);
+    const DRAMSys::MemSpec& memSpec = *config.memSpec;
+    DRAMSys::AddressDecoder addressDecoder(configuration.addressmapping, memSpec);
+
+    std::ifstream traceFile(tracePath);
+    if (!traceFile)
+    {
+        std::cerr << "Could not open trace " << tracePath << std::endl;
+        return 1;
+    }
+    bool relative = tracePath.extension() == ".rstl";
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(outputDirectory, errorCode);
+    if (errorCode)
+    {
+        std::cerr << "Could not create " << outputDirectory << ": " << errorCode.message() << std::endl;
+        return 1;
+    }
+
+    const std::string modeName = mode == Mode::Channel ? "channel" : mode == Mode::Thread ? "thread" : "slice";
+    auto shardFileName = [&](uint64_t shard)
+    {
+        return tracePath.stem().string() + "_" + modeName + std::to_string(shard) + tracePath.extension().string();
+    };
+
+    if (mode == Mode::Channel)
+        numberOfThreads = std::min(numberOfThreads, memSpec.numberOfChannels);
+    else if (mode == Mode::Thread)
+        numberOfThreads = static_cast<unsigned>(std::min<uint64_t>(numberOfThreads, parameter));
+    numberOfThreads = std::max(numberOfThreads, 1U);
+
+    std::atomic<bool> writeError = false;
+    std::vector<BufferQueue> queues(numberOfThreads);
+    std::vector<std::thread> writers;
+    for (unsigned thread = 0; thread < numberOfThreads; thread++)
+    {
+        writers.emplace_back([&, thread]()
+        {
+            std::unordered_map<uint64_t, std::ofstream> files;
+            Buffer buffer;
+            while (queues[thread].pop(buffer))
+            {
+                auto it = files.find(buffer.shard);
+                if (it == files.end())
+                {
+                    it = files.emplace(buffer.shard, std::ofstream(outputDirectory / shardFileName(buffer.shard),
+                                                                   std::ios::binary)).first;
+                }
+
+                it->second.write(buffer.data.data(), static_cast<std::streamsize>(buffer.data.size()));
+                if (buffer.last)
+                {
+                    it->second.close();
+                    if (!it->second)
+                        writeError = true;
+                    files.erase(it);
+                }
+            }
+        });
+    }
+
+    // One shard per channel or thread. Slices of a time-ordered trace are completed one after the
+    // other, so only the current slice is kept and moved to the finished shards once it is complete.
+    std::vector<Shard> shards(mode == Mode::Time ? 1 : 0);
+
+    std::vector<Shard> finishedShards;
+    auto flush = [&](Shard& shard, bool last)
+    {
+        queues[shard.index % numberOfThreads].push({shard.index, std::move(shard.data), last});
+        shard.data = std::string();
+        if (last)
+            finishedShards.push_back(shard);
+        else
+            shard.data.reserve(BUFFER_SIZE + 256);
+    };
+
+    bool failed = false;
+    uint64_t requests = 0;
+    uint64_t lastTime = 0;
+    std::string line;
+    uint64_t lineNumber = 0;
+    while (std::getline(traceFile, line))
+    {
+        lineNumber++;
+        if (isStlComment(line))
+            continue;
+
+        std::optional<StlRecord> record = parseStlRecord(line);
+        if (!record)
+        {
+            std::cerr << "Malformed trace file line " << lineNumber << std::endl;
+            failed = true;
+            break;
+        }
+        uint64_t time = record->time;
+        uint64_t address = record->address;
+
+        uint64_t absoluteTime = relative ? lastTime + time : time;
+        lastTime = absoluteTime;
+
+        uint64_t shard = 0;
+        if (mode == Mode::Channel)
+            shard = addressDecoder.decodeChannel(address);
+        else if (mode == Mode::Thread)
+            shard = requests % parameter;
+        requests++;
+
+        while (mode != Mode::Time && shard >= shards.size())
+        {
+            shards.emplace_back();
+            shards.back().index = shards.size() - 1;
+        }
+
+        if (mode == Mode::Time)
+        {
+            uint64_t slice = absoluteTime / parameter;
+            if (slice < shards.front().index)
+            {
+                std::cerr << "Trace file line " << lineNumber << " is not ordered by time" << std::endl;
+                failed = true;
+                break;
+            }
+            if (slice > shards.front().index)
+            {
+                if (shards.front().requests != 0)
+                    flush(shards.front(), true);
+                shards.front() = Shard();
+                shards.front().index = slice;
+            }
+        }
+
+        // Time slices are rebased to the start of the slice, relative traces keep the delay
+        // to the previous request of the same shard
+        Shard& target = shards[shard];
+        uint64_t base = mode == Mode::Time ? target.index * parameter : 0;
+        uint64_t outputTime = absoluteTime - base;
+        if (relative && target.requests != 0)
+            outputTime = absoluteTime - target.lastTime;
+
+        if (target.requests == 0)
+            target.firstTime = absoluteTime;
+        target.lastTime = absoluteTime;
+        target.requests++;
+        if (record->isRead)
+            target.reads++;
+        else
+            target.writes++;
+
+        target.data += std::to_string(outputTime);
+        target.data.append(line, record->colon, std::string::npos);
+        target.data += '\n';
+        if (target.data.size() >= BUFFER_SIZE)
+            flush(target, false);
+    }
+
+    for (auto& shard : shards)
+    {
+        if (shard.requests != 0)
+            flush(shard, true);
+    }
+    for (auto& queue : queues)
+        queue.close();
+    for (auto& writer : writers)
+        writer.join();
+
+    if (failed)
+        return 1;
+
+    if (writeError)
+    {
+        std::cerr << "Could not write shards to " << outputDirectory << std::endl;
+        return 1;
+    }
+
+    nlohmann::json manifest;
+    manifest["trace"] = tracePath.string();
+    manifest["partitioning"] = modeName;
+    if (mode == Mode::Thread)
+        manifest["threads"] = parameter;
+    else if (mode == Mode::Time)
+        manifest["sliceCycles"] = parameter;
+    manifest["requests"] = requests;
+    manifest["shards"] = nlohmann::json::array();
+
+    std::cout << "Trace:    " << tracePath.string() << std::endl;
+    std::cout << "Requests: " << requests << std::endl;
+    for (const Shard& current : finishedShards)
+    {
+        manifest["shards"].push_back({{"index", current.index},
+                                      {"file", shardFileName(current.index)},
+                                      {"requests", current.requests},
+                                      {"reads", current.reads},
+                                      {"writes", current.writes},
+                                      {"firstTime", current.firstTime},
+                                      {"lastTime", current.lastTime}});
+
+        std::cout << "  " << shardFileName(current.index) << ": " << current.requests << " requests ("
+                  << current.reads << " reads, " << current.writes << " writes), cycles "
+                  << current.firstTime << " to " << current.lastTime << std::endl;
+    }
+
+    std::filesystem::path manifestPath = outputDirectory / (tracePath.stem().string() + "_manifest.json");
+    std::ofstream manifestFile(manifestPath);
+    manifestFile << manifest.dump(4) << std::endl;
+    if (!manifestFile)
+    {
+        std::cerr << "Could not write " << manifestPath << std::endl;
+        return 1;
+    }
+    std::cout << "Written " << manifestPath.string() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef REUSEDISTANCE_H
+#define REUSEDISTANCE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Stack (reuse) distance with a Fenwick tree over access timestamps: the most recent access of
+// every block is marked with a one, the distance of a reuse is the number of marks after the
+// previous access of the block. Timestamps are compacted when the tree is full so that its size
+// is bounded by the footprint instead of the trace length.
+class ReuseDistance
+{
+public:
+    // The initial capacity has to be positive
+    explicit ReuseDistance(uint32_t initialCapacity = INITIAL_CAPACITY) : tree(initialCapacity + 1, 0) {}
+
+    // Returns the number of distinct blocks accessed since the last access of block, or -1 for
+    // the first access
+    int64_t access(uint64_t block)
+    {
+        if (now == capacity())
+            compact();
+
+        int64_t distance = -1;
+        auto it = lastAccess.find(block);
+        if (it != lastAccess.end())
+        {
+            distance = prefixSum(now) - prefixSum(it->second + 1);
+            add(it->second, -1);
+            it->second = now;
+        }
+        else
+        {
+            lastAccess.emplace(block, now);
+        }
+
+        add(now, 1);
+        now++;
+        return distance;
+    }
+
+    [[nodiscard]] uint64_t footprint() const
+    {
+        return lastAccess.size();
+    }
+
+    static constexpr uint32_t INITIAL_CAPACITY = 1 << 20;
+
+private:
+    std::vector<int32_t> tree;
+    std::unordered_map<uint64_t, uint32_t> lastAccess;
+    uint32_t now = 0;
+
+    [[nodiscard]] uint32_t capacity() const
+    {
+        return static_cast<uint32_t>(tree.size() - 1);
+    }
+
+    void add(uint32_t index, int32_t value)
+    {
+        for (index++; index < tree.size(); index += index & (~index + 1))
+            tree[index] += value;
+    }
+
+    // Sum of the marks in [0, end)
+    [[nodiscard]] int64_t prefixSum(uint32_t end) const
+    {
+        int64_t sum = 0;
+        for (; end > 0; end -= end & (~end + 1))
+            sum += tree[end];
+        return sum;
+    }
+
+    void compact()
+    {
+        std::vector<std::pair<uint32_t, uint64_t>> live;
+        live.reserve(lastAccess.size());
+        for (const auto& [block, time] : lastAccess)
+            live.emplace_back(time, block);
+        std::sort(live.begin(), live.end());
+
+        uint64_t newCapacity = capacity();
+        while (live.size() > newCapacity / 2)
+            newCapacity *= 2;
+        if (newCapacity > UINT32_MAX)
+        {
+            std::cerr << "Footprint too large for reuse distance analysis" << std::endl;
+            std::exit(1);
+        }
+
+        tree.assign(newCapacity + 1, 0);
+        for (uint32_t time = 0; time < live.size(); time++)
+        {
+            lastAccess[live[time].second] = time;
+            add(time, 1);
+        }
+        now = static_cast<uint32_t>(live.size());
+    }
+};
+
+#endif // REUSEDISTANCE_H
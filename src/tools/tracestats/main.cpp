@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "ReuseDistance.h"
+
+#include <common/StlTrace.h>
+
+#include <DRAMSys/config/DRAMSysConfiguration.h>
+#include <DRAMSys/configuration/Configuration.h>
+#include <DRAMSys/simulation/AddressDecoder.h>
+
+#include <systemc>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Characterizes an .stl/.rstl trace offline: the trace is streamed through the AddressDecoder of a
+// DRAMSys configuration, the per-channel statistics (ideal open-page row hits, bank distribution
+// and reuse distances) are computed by one worker thread per group of channels.
+
+namespace
+{
+
+constexpr unsigned HISTOGRAM_BUCKETS = 65;
+constexpr std::size_t CHUNK_SIZE = 1 << 16;
+constexpr std::size_t MAX_QUEUED_CHUNKS = 8;
+constexpr uint32_t NO_ROW = UINT32_MAX;
+
+struct Access
+{
+    uint64_t block;
+    uint32_t channel;
+    uint32_t bank;
+    uint32_t row;
+};
+
+// Bucket 0 holds the value 0, bucket i > 0 holds values in [2^(i-1), 2^i)
+unsigned log2Bucket(uint64_t value)
+{
+    unsigned bucket = 0;
+    while (value != 0)
+    {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+std::string bucketRange(unsigned bucket)
+{
+    if (bucket == 0)
+        return "0";
+    if (bucket == 1)
+        return "1";
+
+    return "[" + std::to_string(UINT64_C(1) << (bucket - 1)) + ", "
+            + std::to_string((UINT64_C(1) << bucket) - 1) + "]";
+}
+
+double percent(uint64_t part, uint64_t total)
+{
+    return total == 0 ? 0.0 : static_cast<double>(part) / static_cast<double>(total) * 100.0;
+}
+
+struct ChannelStatistics
+{
+    explicit ChannelStatistics(unsigned banksPerChannel)
+        : openRow(banksPerChannel, NO_ROW), bankAccesses(banksPerChannel, 0) {}
+
+    void process(const Access& access)
+    {
+        accesses++;
+        if (openRow[access.bank] == access.row)
+            rowHits++;
+        openRow[access.bank] = access.row;
+        bankAccesses[access.bank]++;
+
+        int64_t distance = reuse.access(access.block);
+        if (distance < 0)
+            coldAccesses++;
+        else
+            reuseHistogram[log2Bucket(static_cast<uint64_t>(distance))]++;
+    }
+
+    uint64_t accesses = 0;
+    uint64_t rowHits = 0;
+    uint64_t coldAccesses = 0;
+    std::vector<uint32_t> openRow;
+    std::vector<uint64_t> bankAccesses;
+    std::array<uint64_t, HISTOGRAM_BUCKETS> reuseHistogram{};
+    ReuseDistance reuse;
+};
+
+using ChunkQueue = BoundedQueue<std::vector<Access>, MAX_QUEUED_CHUNKS>;
+
+} // namespace
+
+int sc_main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <config.json> <trace.stl|trace.rstl> [resource directory] [threads]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::filesystem::path baseConfig = argv[1];
+    std::filesystem::path tracePath = argv[2];
+    std::filesystem::path resourceDirectory = argc >= 4 ? argv[3] : DRAMSYS_RESOURCE_DIR;
+    unsigned numberOfThreads = argc >= 5 ? static_cast<unsigned>(std::stoul(argv[4]))
+                                         : std::max(1U, std::thread::hardware_concurrency());
+
+    DRAMSys::Config::Configuration configuration =
+        DRAMSys::Config::from_path(baseConfig.c_str(), resourceDirectory.c_str());
+
+    DRAMSys::Configuration config;
+    config.loadMemSpec(configuration.memspec);
+    const DRAMSys::MemSpec& memSpec = *config.memSpec;
+    DRAMSys::AddressDecoder addressDecoder(configuration.addressmapping, memSpec);
+
+    std::ifstream traceFile(tracePath);
+    if (!traceFile)
+    {
+        std::cerr << "Could not open trace " << tracePath << std::endl;
+        return 1;
+    }
+    bool relative = tracePath.extension() == ".rstl";
+
+    const unsigned numberOfChannels = memSpec.numberOfChannels;
+    numberOfThreads = std::clamp(numberOfThreads, 1U, numberOfChannels);
+    const uint64_t blockSize = memSpec.defaultBytesPerBurst;
+
+    std::vector<ChannelStatistics> channels(numberOfChannels, ChannelStatistics(memSpec.banksPerChannel));
+    std::vector<ChunkQueue> queues(numberOfThreads);
+    std::vector<std::thread> workers;
+    for (unsigned thread = 0; thread < numberOfThreads; thread++)
+    {
+        workers.emplace_back([&, thread]()
+        {
+            std::vector<Access> chunk;
+            while (queues[thread].pop(chunk))
+            {
+                for (const auto& access : chunk)
+                    channels[access.channel].process(access);
+            }
+        });
+    }
+
+    uint64_t reads = 0;
+    uint64_t writes = 0;
+    uint64_t bytes = 0;
+    uint64_t lastTime = 0;
+    uint64_t firstTime = 0;
+    uint64_t interArrivalSum = 0;
+    std::array<uint64_t, HISTOGRAM_BUCKETS> interArrivalHistogram{};
+    std::vector<std::vector<Access>> chunks(numberOfThreads);
+
+    std::string line;
+    uint64_t lineNumber = 0;
+    while (std::getline(traceFile, line))
+    {
+        lineNumber++;
+        if (isStlComment(line))
+            continue;
+
+        std::optional<StlRecord> record = parseStlRecord(line);
+        if (!record)
+        {
+            std::cerr << "Malformed trace file line " << lineNumber << std::endl;
+            return 1;
+        }
+        uint64_t time = record->time;
+        uint64_t address = record->address;
+
+        if (record->isRead)
+            reads++;
+        else
+            writes++;
+        bytes += record->length.value_or(memSpec.defaultBytesPerBurst);
+
+        uint64_t requests = reads + writes;
+        if (requests == 1)
+        {
+            firstTime = relative ? 0 : time;
+        }
+        else
+        {
+            uint64_t interArrival = relative ? time : time - std::min(time, lastTime);
+            interArrivalSum += interArrival;
+            interArrivalHistogram[log2Bucket(interArrival)]++;
+        }
+        lastTime = relative ? lastTime + time : time;
+
+        DRAMSys::DecodedAddress decodedAddress = addressDecoder.decodeAddress(address);
+        unsigned thread = decodedAddress.channel % numberOfThreads;
+        chunks[thread].push_back({address / blockSize, decodedAddress.channel, decodedAddress.bank,
+                                  decodedAddress.row});
+        if (chunks[thread].size() == CHUNK_SIZE)
+        {
+            queues[thread].push(std::move(chunks[thread]));
+            chunks[thread] = std::vector<Access>();
+            chunks[thread].reserve(CHUNK_SIZE);
+        }
+    }
+
+    for (unsigned thread = 0; thread < numberOfThreads; thread++)
+    {
+        if (!chunks[thread].empty())
+            queues[thread].push(std::move(chunks[thread]));
+        queues[thread].close();
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    uint64_t requests = reads + writes;
+    uint64_t rowHits = 0;
+    uint64_t footprint = 0;
+    uint64_t coldAccesses = 0;
+    std::array<uint64_t, HISTOGRAM_BUCKETS> reuseHistogram{};
+    for (const auto& channel : channels)
+    {
+        rowHits += channel.rowHits;
+        footprint += channel.reuse.footprint();
+        coldAccesses += channel.coldAccesses;
+        for (unsigned bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+            reuseHistogram[bucket] += channel.reuseHistogram[bucket];
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Trace:                 " << tracePath.string() << std::endl;
+    std::cout << "Requests:              " << requests << " (" << reads << " reads, " << writes << " writes, "
+              << percent(reads, requests) << " % reads)" << std::endl;
+    std::cout << "Bytes:                 " << bytes << std::endl;
+    std::cout << "Footprint:             " << footprint * blockSize << " bytes (" << footprint << " blocks of "
+              << blockSize << " bytes)" << std::endl;
+    std::cout << "Duration:              " << lastTime - firstTime << " cycles" << std::endl;
+    std::cout << "Row hit rate (ideal open page): " << percent(rowHits, requests) << " %" << std::endl;
+
+    std::cout << std::endl << "Inter-arrival time in cycles (AVG "
+              << (requests > 1 ? static_cast<double>(interArrivalSum) / static_cast<double>(requests - 1) : 0.0)
+              << "):" << std::endl;
+    for (unsigned bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+    {
+        if (interArrivalHistogram[bucket] != 0)
+        {
+            std::cout << "  " << std::setw(26) << bucketRange(bucket) << ": " << std::setw(12)
+                      << interArrivalHistogram[bucket] << " (" << std::setw(6)
+                      << percent(interArrivalHistogram[bucket], requests - 1) << " %)" << std::endl;
+        }
+    }
+
+    std::cout << std::endl << "Reuse distance in distinct blocks of the same channel:" << std::endl;
+    std::cout << "  " << std::setw(26) << "first access" << ": " << std::setw(12) << coldAccesses << " ("
+              << std::setw(6) << percent(coldAccesses, requests) << " %)" << std::endl;
+    for (unsigned bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+    {
+        if (reuseHistogram[bucket] != 0)
+        {
+            std::cout << "  " << std::setw(26) << bucketRange(bucket) << ": " << std::setw(12)
+                      << reuseHistogram[bucket] << " (" << std::setw(6)
+                      << percent(reuseHistogram[bucket], requests) << " %)" << std::endl;
+        }
+    }
+
+    std::cout << std::endl << "Distribution:" << std::endl;
+    for (unsigned channelID = 0; channelID < numberOfChannels; channelID++)
+    {
+        const ChannelStatistics& channel = channels[channelID];
+        std::cout << "  Channel " << channelID << ": " << channel.accesses << " ("
+                  << percent(channel.accesses, requests) << " %), row hit rate "
+                  << percent(channel.rowHits, channel.accesses) << " %" << std::endl;
+
+        for (unsigned bankGroup = 0; bankGroup < memSpec.bankGroupsPerChannel; bankGroup++)
+        {
+            uint64_t groupAccesses = 0;
+            for (unsigned bank = bankGroup * memSpec.banksPerGroup;
+                 bank < (bankGroup + 1) * memSpec.banksPerGroup; bank++)
+                groupAccesses += channel.bankAccesses[bank];
+
+            if (groupAccesses == 0)
+                continue;
+
+            std::cout << "    Bank group " << std::setw(3) << bankGroup << ": " << std::setw(12) << groupAccesses
+                      << " (" << std::setw(6) << percent(groupAccesses, channel.accesses) << " %) banks";
+            for (unsigned bank = bankGroup * memSpec.banksPerGroup;
+                 bank < (bankGroup + 1) * memSpec.banksPerGroup; bank++)
+                std::cout << " " << percent(channel.bankAccesses[bank], channel.accesses);
+            std::cout << std::endl;
+        }
+    }
+
+    return 0;
+}
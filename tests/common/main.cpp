@@ -29,13 +29,15 @@
  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
- * Authors:
- *    Matthias Jung
- *    Derek Christ
+ * Author: agent
  */
 
-#pragma once
+#include <gtest/gtest.h>
+#include <systemc>
 
-#include <cstdint>
-
-void loadBar(uint64_t x, uint64_t n, unsigned int w = 50, unsigned int granularity = 1);
+// SystemC provides main(), so the tests are run from sc_main instead of gtest_main
+int sc_main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
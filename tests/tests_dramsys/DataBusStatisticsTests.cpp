@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/simulation/dram/DataBusStatistics.h>
+
+#include <random>
+#include <vector>
+
+using namespace DRAMSys;
+
+namespace
+{
+
+unsigned ones(unsigned char byte)
+{
+    unsigned count = 0;
+    for (; byte != 0; byte >>= 1)
+        count += byte & 1U;
+    return count;
+}
+
+} // namespace
+
+TEST(DataBusStatistics, CountsTogglesAndZerosPerEncoding)
+{
+    DataBusStatistics statistics(1, 1.0, 1.0);
+    const std::vector<unsigned char> burst = {0x00, 0xff};
+    statistics.transfer(burst.data(), static_cast<unsigned>(burst.size()));
+
+    EXPECT_EQ(statistics.getBeats(), 2);
+
+    // The bus starts with all lines low
+    EXPECT_EQ(statistics.getToggles(DataBusStatistics::Plain), 8);
+    EXPECT_EQ(statistics.getZeros(DataBusStatistics::Plain), 8);
+
+    // 0xff would toggle all lines, it is sent inverted with the DBI pin toggling low
+    EXPECT_EQ(statistics.getToggles(DataBusStatistics::DbiAc), 1);
+    EXPECT_EQ(statistics.getZeros(DataBusStatistics::DbiAc), 17);
+
+    // 0x00 consists of zeros only, it is sent inverted as 0xff with a low DBI pin
+    EXPECT_EQ(statistics.getToggles(DataBusStatistics::DbiDc), 10);
+    EXPECT_EQ(statistics.getZeros(DataBusStatistics::DbiDc), 1);
+}
+
+TEST(DataBusStatistics, LanesAreInvertedIndependently)
+{
+    DataBusStatistics statistics(2, 1.0, 1.0);
+    const std::vector<unsigned char> burst = {0x01, 0xfe};
+    statistics.transfer(burst.data(), static_cast<unsigned>(burst.size()));
+
+    // DC: the first lane has seven zeros and is inverted, the second lane has one zero
+    EXPECT_EQ(statistics.getZeros(DataBusStatistics::DbiDc), 1 + 1 + 1);
+    EXPECT_EQ(statistics.getToggles(DataBusStatistics::DbiDc), 7 + 1 + 7);
+
+    // AC: the first lane toggles one line, the second lane seven and is inverted
+    EXPECT_EQ(statistics.getToggles(DataBusStatistics::DbiAc), 1 + 1 + 1);
+}
+
+TEST(DataBusStatistics, PlainCountsMatchBitwiseReference)
+{
+    // 8 bytes per beat and 64 byte bursts exercise the word-wise popcount, the second burst
+    // continues from the last beat of the first one
+    constexpr unsigned bytesPerBeat = 8;
+    DataBusStatistics statistics(bytesPerBeat, 1.0, 1.0);
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<unsigned> distribution(0, 255);
+
+    std::vector<unsigned char> lastBeat(bytesPerBeat, 0);
+    uint64_t toggles = 0;
+    uint64_t zeros = 0;
+    for (unsigned burst = 0; burst < 2; burst++)
+    {
+        std::vector<unsigned char> data(64);
+        for (auto& byte : data)
+            byte = static_cast<unsigned char>(distribution(generator));
+
+        for (unsigned index = 0; index < data.size(); index++)
+        {
+            unsigned char previous = index < bytesPerBeat ? lastBeat[index] : data[index - bytesPerBeat];
+            toggles += ones(static_cast<unsigned char>(data[index] ^ previous));
+            zeros += 8 - ones(data[index]);
+        }
+        std::copy(data.end() - bytesPerBeat, data.end(), lastBeat.begin());
+
+        statistics.transfer(data.data(), static_cast<unsigned>(data.size()));
+    }
+
+    EXPECT_EQ(statistics.getBeats(), 16);
+    EXPECT_EQ(statistics.getToggles(DataBusStatistics::Plain), toggles);
+    EXPECT_EQ(statistics.getZeros(DataBusStatistics::Plain), zeros);
+}
+
+TEST(DataBusStatistics, DbiNeverDrivesMoreThanHalfTheLanes)
+{
+    // With DBI at most four data lines plus the DBI pin toggle (AC) or are low (DC) per byte
+    DataBusStatistics statistics(4, 1.0, 1.0);
+    std::mt19937 generator(2);
+    std::uniform_int_distribution<unsigned> distribution(0, 255);
+
+    std::vector<unsigned char> data(32);
+    for (auto& byte : data)
+        byte = static_cast<unsigned char>(distribution(generator));
+    statistics.transfer(data.data(), static_cast<unsigned>(data.size()));
+
+    EXPECT_LE(statistics.getToggles(DataBusStatistics::DbiAc), data.size() * 5);
+    EXPECT_LE(statistics.getZeros(DataBusStatistics::DbiDc), data.size() * 5);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/controller/IngressQueue.h>
+
+#include <set>
+#include <vector>
+
+using namespace DRAMSys;
+
+namespace
+{
+
+class IngressQueueTest : public ::testing::Test
+{
+protected:
+    IngressQueueTest() : payloads(4), queue(4)
+    {
+        // Four requests of 64 bytes to consecutive addresses
+        for (unsigned i = 0; i < payloads.size(); i++)
+        {
+            payloads[i].set_address(i * 64);
+            payloads[i].set_data_length(64);
+        }
+    }
+
+    bool admit()
+    {
+        return queue.admit([this](const tlm::tlm_generic_payload& trans) { return multiBurst.count(&trans) == 0; },
+                           [this](const tlm::tlm_generic_payload& trans) { return blocked.count(&trans) == 0; },
+                           [this](tlm::tlm_generic_payload& trans) { stored.push_back(&trans); });
+    }
+
+    std::vector<tlm::tlm_generic_payload> payloads;
+    IngressQueue queue;
+    std::set<const tlm::tlm_generic_payload*> blocked;
+    std::set<const tlm::tlm_generic_payload*> multiBurst;
+    std::vector<const tlm::tlm_generic_payload*> stored;
+};
+
+} // namespace
+
+TEST_F(IngressQueueTest, AdmitsInArrivalOrder)
+{
+    for (auto& trans : payloads)
+        queue.push(trans);
+    EXPECT_TRUE(queue.isFull());
+
+    EXPECT_TRUE(admit());
+    ASSERT_EQ(stored.size(), 4);
+    for (unsigned i = 0; i < payloads.size(); i++)
+        EXPECT_EQ(stored[i], &payloads[i]);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.getBypasses(), 0);
+}
+
+TEST_F(IngressQueueTest, BypassesRequestToFullBank)
+{
+    queue.push(payloads[0]);
+    queue.push(payloads[1]);
+    blocked.insert(&payloads[0]);
+
+    EXPECT_TRUE(admit());
+    ASSERT_EQ(stored.size(), 1);
+    EXPECT_EQ(stored[0], &payloads[1]);
+    EXPECT_EQ(queue.getBypasses(), 1);
+
+    blocked.clear();
+    EXPECT_TRUE(admit());
+    ASSERT_EQ(stored.size(), 2);
+    EXPECT_EQ(stored[1], &payloads[0]);
+    EXPECT_FALSE(admit());
+}
+
+TEST_F(IngressQueueTest, NeverOvertakesOverlappingRequest)
+{
+    // The write to the same address and the partially overlapping request wait for the head
+    payloads[1].set_address(0);
+    payloads[2].set_address(32);
+    for (auto& trans : payloads)
+        queue.push(trans);
+    blocked.insert(&payloads[0]);
+
+    EXPECT_TRUE(admit());
+    ASSERT_EQ(stored.size(), 1);
+    EXPECT_EQ(stored[0], &payloads[3]);
+
+    blocked.clear();
+    EXPECT_TRUE(admit());
+    ASSERT_EQ(stored.size(), 4);
+    EXPECT_EQ(stored[1], &payloads[0]);
+    EXPECT_EQ(stored[2], &payloads[1]);
+    EXPECT_EQ(stored[3], &payloads[2]);
+}
+
+TEST_F(IngressQueueTest, OverlapWithBlockedYoungerRequestBlocks)
+{
+    // payloads[2] overlaps the blocked payloads[1] that is older, but not the head
+    payloads[2].set_address(64);
+    for (unsigned i = 0; i < 3; i++)
+        queue.push(payloads[i]);
+    blocked.insert(&payloads[1]);
+
+    EXPECT_TRUE(admit());
+    ASSERT_EQ(stored.size(), 1);
+    EXPECT_EQ(stored[0], &payloads[0]);
+    EXPECT_EQ(queue.getBypasses(), 0);
+}
+
+TEST_F(IngressQueueTest, MultiBurstRequestsOnlyFromHead)
+{
+    queue.push(payloads[0]);
+    queue.push(payloads[1]);
+    blocked.insert(&payloads[0]);
+    multiBurst.insert(&payloads[1]);
+
+    EXPECT_FALSE(admit());
+    EXPECT_TRUE(stored.empty());
+
+    blocked.clear();
+    EXPECT_TRUE(admit());
+    ASSERT_EQ(stored.size(), 2);
+    EXPECT_EQ(stored[1], &payloads[1]);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/common/PayloadTable.h>
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace DRAMSys;
+
+TEST(PayloadTable, InsertFindErase)
+{
+    std::vector<tlm::tlm_generic_payload> payloads(3);
+    PayloadTable<unsigned> table;
+
+    table.insert(&payloads[0]) = 10;
+    table.insert(&payloads[1]) = 11;
+    EXPECT_EQ(table.size(), 2);
+    ASSERT_NE(table.find(&payloads[0]), nullptr);
+    EXPECT_EQ(*table.find(&payloads[0]), 10);
+    EXPECT_EQ(table.find(&payloads[2]), nullptr);
+
+    table.erase(&payloads[0]);
+    table.erase(&payloads[2]);
+    EXPECT_EQ(table.size(), 1);
+    EXPECT_EQ(table.find(&payloads[0]), nullptr);
+    ASSERT_NE(table.find(&payloads[1]), nullptr);
+    EXPECT_EQ(*table.find(&payloads[1]), 11);
+}
+
+TEST(PayloadTable, GrowsBelowHalfLoad)
+{
+    std::vector<tlm::tlm_generic_payload> payloads(100);
+    PayloadTable<unsigned> table(4);
+
+    for (unsigned i = 0; i < payloads.size(); i++)
+    {
+        table.insert(&payloads[i]) = i;
+        EXPECT_LE(2 * table.size(), table.capacity());
+    }
+
+    for (unsigned i = 0; i < payloads.size(); i++)
+    {
+        ASSERT_NE(table.find(&payloads[i]), nullptr);
+        EXPECT_EQ(*table.find(&payloads[i]), i);
+    }
+}
+
+TEST(PayloadTable, BackwardShiftKeepsProbeSequences)
+{
+    // Random inserts and erases on a small table create long clusters that wrap around its end,
+    // every remaining entry has to stay reachable with its value after each erase
+    std::vector<tlm::tlm_generic_payload> payloads(31);
+    PayloadTable<unsigned> table(64);
+    std::unordered_map<const tlm::tlm_generic_payload*, unsigned> reference;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> distribution(0, payloads.size() - 1);
+
+    for (unsigned step = 0; step < 100000; step++)
+    {
+        const tlm::tlm_generic_payload* trans = &payloads[distribution(generator)];
+        if (reference.count(trans) == 0)
+        {
+            table.insert(trans) = step;
+            reference[trans] = step;
+        }
+        else
+        {
+            table.erase(trans);
+            reference.erase(trans);
+            EXPECT_EQ(table.find(trans), nullptr);
+        }
+
+        ASSERT_EQ(table.size(), reference.size());
+        ASSERT_EQ(table.capacity(), 64);
+        for (const auto& [key, value] : reference)
+        {
+            const unsigned* entry = table.find(key);
+            ASSERT_NE(entry, nullptr);
+            ASSERT_EQ(*entry, value);
+        }
+    }
+}
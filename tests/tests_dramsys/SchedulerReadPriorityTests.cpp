@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/config/DRAMSysConfiguration.h>
+#include <DRAMSys/configuration/Configuration.h>
+#include <DRAMSys/controller/BankMachine.h>
+#include <DRAMSys/controller/scheduler/SchedulerReadPriority.h>
+
+#include <memory>
+#include <vector>
+
+using namespace DRAMSys;
+
+namespace
+{
+
+class SchedulerReadPriorityTest : public ::testing::Test
+{
+protected:
+    SchedulerReadPriorityTest() : payloads(8)
+    {
+        auto configLib = Config::from_path(DRAMSYS_RESOURCE_DIR "/stt-mram-example.json");
+        config.loadMemSpec(configLib.memspec);
+        config.writeBatchSize = 4;
+
+        scheduler = std::make_unique<SchedulerReadPriority>(config);
+        bankMachine = std::make_unique<BankMachineOpen>(config, *scheduler, Bank(0));
+    }
+
+    // All requests target bank 0, the bank machine is precharged so there are no row hits
+    tlm::tlm_generic_payload& store(unsigned id, tlm::tlm_command command, uint64_t address,
+                                    unsigned length = 64)
+    {
+        tlm::tlm_generic_payload& trans = payloads.at(id);
+        trans.set_command(command);
+        trans.set_address(address);
+        trans.set_data_length(length);
+        ControllerExtension::setExtension(trans, id, Rank(0), BankGroup(0), Bank(0), Row(0),
+                                          Column(static_cast<unsigned>(address / 64)), 8);
+        scheduler->storeRequest(trans);
+        return trans;
+    }
+
+    [[nodiscard]] const tlm::tlm_generic_payload* next() const
+    {
+        return scheduler->getNextRequest(*bankMachine);
+    }
+
+    std::vector<tlm::tlm_generic_payload> payloads;
+    Configuration config;
+    std::unique_ptr<SchedulerReadPriority> scheduler;
+    std::unique_ptr<BankMachine> bankMachine;
+};
+
+} // namespace
+
+TEST_F(SchedulerReadPriorityTest, ReadOvertakesIndependentWrite)
+{
+    store(0, tlm::TLM_WRITE_COMMAND, 0);
+    auto& read = store(1, tlm::TLM_READ_COMMAND, 64);
+
+    EXPECT_EQ(next(), &read);
+}
+
+TEST_F(SchedulerReadPriorityTest, ReadWaitsForOlderWriteToSameAddress)
+{
+    auto& write = store(0, tlm::TLM_WRITE_COMMAND, 0);
+    auto& read = store(1, tlm::TLM_READ_COMMAND, 0);
+
+    EXPECT_EQ(next(), &write);
+
+    scheduler->removeRequest(write);
+    EXPECT_EQ(next(), &read);
+}
+
+TEST_F(SchedulerReadPriorityTest, PartialOverlapIsAHazard)
+{
+    auto& write = store(0, tlm::TLM_WRITE_COMMAND, 0, 64);
+    store(1, tlm::TLM_READ_COMMAND, 32, 64);
+
+    EXPECT_EQ(next(), &write);
+}
+
+TEST_F(SchedulerReadPriorityTest, AdjacentRequestsAreNoHazard)
+{
+    store(0, tlm::TLM_WRITE_COMMAND, 64, 64);
+    auto& read = store(1, tlm::TLM_READ_COMMAND, 0, 64);
+
+    EXPECT_EQ(next(), &read);
+}
+
+TEST_F(SchedulerReadPriorityTest, YoungerWriteDoesNotBlockRead)
+{
+    auto& read = store(0, tlm::TLM_READ_COMMAND, 0);
+    store(1, tlm::TLM_WRITE_COMMAND, 0);
+
+    EXPECT_EQ(next(), &read);
+}
+
+TEST_F(SchedulerReadPriorityTest, WriteBatchWaitsForOlderReadToSameAddress)
+{
+    auto& read = store(0, tlm::TLM_READ_COMMAND, 0);
+    auto& write = store(1, tlm::TLM_WRITE_COMMAND, 0);
+    for (unsigned id = 2; id < 2 + config.writeBatchSize - 1; id++)
+        store(id, tlm::TLM_WRITE_COMMAND, id * 64);
+
+    // The write batch has started, but its oldest write must not overtake the read
+    EXPECT_EQ(next(), &read);
+
+    scheduler->removeRequest(read);
+    EXPECT_EQ(next(), &write);
+}
+
+TEST_F(SchedulerReadPriorityTest, WriteBatchOvertakesIndependentRead)
+{
+    store(0, tlm::TLM_READ_COMMAND, 0);
+    auto& write = store(1, tlm::TLM_WRITE_COMMAND, 64);
+    for (unsigned id = 2; id < 2 + config.writeBatchSize - 1; id++)
+        store(id, tlm::TLM_WRITE_COMMAND, id * 64);
+
+    EXPECT_EQ(next(), &write);
+}
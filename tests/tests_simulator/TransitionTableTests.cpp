@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    agent
+ */
+
+#include <gtest/gtest.h>
+
+#include <simulator/generator/TransitionTable.h>
+
+#include <map>
+
+namespace
+{
+
+// Relative frequency of each target over evenly spaced uniform numbers
+std::map<unsigned int, double> sampleFrequencies(TransitionTable const &table)
+{
+    constexpr unsigned int samples = 100000;
+    std::map<unsigned int, double> frequencies;
+    for (unsigned int i = 0; i < samples; i++)
+        frequencies[table.sample((i + 0.5) / samples)] += 1.0 / samples;
+    return frequencies;
+}
+
+std::map<unsigned int, double> aggregate(std::vector<std::pair<unsigned int, double>> const &probabilities)
+{
+    std::map<unsigned int, double> result;
+    for (auto const &[target, probability] : probabilities)
+        result[target] += probability;
+    return result;
+}
+
+} // namespace
+
+TEST(AliasTable, SamplesWithTransitionProbabilities)
+{
+    TransitionTable table({{1, 0.1}, {2, 0.2}, {3, 0.7}});
+
+    auto frequencies = sampleFrequencies(table);
+    EXPECT_NEAR(frequencies[1], 0.1, 1e-4);
+    EXPECT_NEAR(frequencies[2], 0.2, 1e-4);
+    EXPECT_NEAR(frequencies[3], 0.7, 1e-4);
+}
+
+TEST(AliasTable, NormalizesProbabilities)
+{
+    TransitionTable table({{5, 2.0}, {6, 6.0}});
+
+    auto probabilities = aggregate(table.probabilities());
+    EXPECT_DOUBLE_EQ(probabilities[5], 0.25);
+    EXPECT_DOUBLE_EQ(probabilities[6], 0.75);
+}
+
+TEST(AliasTable, NeverSamplesZeroProbability)
+{
+    TransitionTable table({{1, 0.0}, {2, 1.0}, {3, 0.0}});
+
+    auto frequencies = sampleFrequencies(table);
+    EXPECT_EQ(frequencies.size(), 1);
+    EXPECT_EQ(table.sample(0.0), 2);
+    EXPECT_EQ(table.sample(0.999999), 2);
+}
+
+TEST(AliasTable, RecoversProbabilitiesOfManyTargets)
+{
+    std::vector<std::pair<unsigned int, double>> transitions;
+    double sum = 0.0;
+    for (unsigned int target = 0; target < 17; target++)
+    {
+        transitions.emplace_back(target, target + 1.0);
+        sum += target + 1.0;
+    }
+
+    TransitionTable table(transitions);
+
+    auto probabilities = aggregate(table.probabilities());
+    ASSERT_EQ(probabilities.size(), transitions.size());
+    for (auto const &[target, weight] : transitions)
+        EXPECT_NEAR(probabilities[target], weight / sum, 1e-12);
+}
+
+TEST(AbsorbingChain, LinearChain)
+{
+    std::unordered_map<unsigned int, TransitionTable> tables;
+    tables.emplace(0, TransitionTable({{1, 1.0}}));
+    tables.emplace(1, TransitionTable({{2, 1.0}}));
+
+    auto visits = expectedVisits(tables);
+    ASSERT_TRUE(visits.has_value());
+    EXPECT_NEAR(visits->at(0), 1.0, 1e-9);
+    EXPECT_NEAR(visits->at(1), 1.0, 1e-9);
+    EXPECT_NEAR(visits->at(2), 1.0, 1e-9);
+}
+
+TEST(AbsorbingChain, SelfLoop)
+{
+    // Geometric number of visits with mean 1 / 0.25
+    std::unordered_map<unsigned int, TransitionTable> tables;
+    tables.emplace(0, TransitionTable({{0, 0.75}, {1, 0.25}}));
+
+    auto visits = expectedVisits(tables);
+    ASSERT_TRUE(visits.has_value());
+    EXPECT_NEAR(visits->at(0), 4.0, 1e-8);
+    EXPECT_NEAR(visits->at(1), 1.0, 1e-8);
+}
+
+TEST(AbsorbingChain, Cycle)
+{
+    // v0 = 1 + 0.5 v1, v1 = v0, v2 = 0.5 v1
+    std::unordered_map<unsigned int, TransitionTable> tables;
+    tables.emplace(0, TransitionTable({{1, 1.0}}));
+    tables.emplace(1, TransitionTable({{0, 0.5}, {2, 0.5}}));
+
+    auto visits = expectedVisits(tables);
+    ASSERT_TRUE(visits.has_value());
+    EXPECT_NEAR(visits->at(0), 2.0, 1e-8);
+    EXPECT_NEAR(visits->at(1), 2.0, 1e-8);
+    EXPECT_NEAR(visits->at(2), 1.0, 1e-8);
+}
+
+TEST(AbsorbingChain, RarelyTerminatingCycle)
+{
+    // v0 = 1 + (1 - 1e-7) v1, v1 = v0
+    std::unordered_map<unsigned int, TransitionTable> tables;
+    tables.emplace(0, TransitionTable({{1, 1.0}}));
+    tables.emplace(1, TransitionTable({{0, 1.0 - 1e-7}, {2, 1e-7}}));
+
+    auto visits = expectedVisits(tables);
+    ASSERT_TRUE(visits.has_value());
+    EXPECT_NEAR(visits->at(0) / 1e7, 1.0, 1e-6);
+    EXPECT_NEAR(visits->at(2), 1.0, 1e-6);
+}
+
+TEST(AbsorbingChain, IgnoresUnreachableStates)
+{
+    std::unordered_map<unsigned int, TransitionTable> tables;
+    tables.emplace(0, TransitionTable({{1, 1.0}}));
+    tables.emplace(5, TransitionTable({{5, 1.0}}));
+
+    auto visits = expectedVisits(tables);
+    ASSERT_TRUE(visits.has_value());
+    EXPECT_EQ(visits->size(), 2);
+    EXPECT_EQ(visits->count(5), 0);
+}
+
+TEST(AbsorbingChain, IgnoresZeroProbabilityTransitions)
+{
+    // The trap in state 2 is never entered
+    std::unordered_map<unsigned int, TransitionTable> tables;
+    tables.emplace(0, TransitionTable({{1, 1.0}, {2, 0.0}}));
+    tables.emplace(2, TransitionTable({{2, 1.0}}));
+
+    auto visits = expectedVisits(tables);
+    ASSERT_TRUE(visits.has_value());
+    EXPECT_EQ(visits->count(2), 0);
+    EXPECT_NEAR(visits->at(1), 1.0, 1e-9);
+}
+
+TEST(AbsorbingChain, DetectsNonTermination)
+{
+    std::unordered_map<unsigned int, TransitionTable> cycle;
+    cycle.emplace(0, TransitionTable({{1, 1.0}}));
+    cycle.emplace(1, TransitionTable({{0, 1.0}}));
+    EXPECT_FALSE(expectedVisits(cycle).has_value());
+
+    // Terminates with probability 0.5 only
+    std::unordered_map<unsigned int, TransitionTable> trap;
+    trap.emplace(0, TransitionTable({{1, 0.5}, {2, 0.5}}));
+    trap.emplace(2, TransitionTable({{2, 1.0}}));
+    EXPECT_FALSE(expectedVisits(trap).has_value());
+}
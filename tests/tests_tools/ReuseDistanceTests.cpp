@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <gtest/gtest.h>
+
+#include <tracestats/ReuseDistance.h>
+
+#include <algorithm>
+#include <list>
+#include <random>
+
+namespace
+{
+
+// Reference stack distance with an explicit LRU stack
+class ReuseStack
+{
+public:
+    int64_t access(uint64_t block)
+    {
+        auto it = std::find(stack.begin(), stack.end(), block);
+        int64_t distance = it == stack.end() ? -1 : std::distance(stack.begin(), it);
+        if (it != stack.end())
+            stack.erase(it);
+        stack.push_front(block);
+        return distance;
+    }
+
+private:
+    std::list<uint64_t> stack;
+};
+
+} // namespace
+
+TEST(ReuseDistance, CountsDistinctBlocksBetweenAccesses)
+{
+    ReuseDistance reuse;
+
+    EXPECT_EQ(reuse.access(1), -1);
+    EXPECT_EQ(reuse.access(2), -1);
+    EXPECT_EQ(reuse.access(3), -1);
+    EXPECT_EQ(reuse.access(3), 0);
+    EXPECT_EQ(reuse.access(2), 1);
+    EXPECT_EQ(reuse.access(2), 0);
+    EXPECT_EQ(reuse.access(1), 2);
+    EXPECT_EQ(reuse.footprint(), 3);
+}
+
+TEST(ReuseDistance, MatchesLruStackAcrossCompactions)
+{
+    // A tiny initial capacity compacts and grows the tree many times
+    ReuseDistance reuse(4);
+    ReuseStack reference;
+    std::mt19937_64 generator(7);
+    std::geometric_distribution<uint64_t> distribution(0.05);
+
+    for (unsigned i = 0; i < 50000; i++)
+    {
+        uint64_t block = distribution(generator);
+        ASSERT_EQ(reuse.access(block), reference.access(block)) << "access " << i << " to block " << block;
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <gtest/gtest.h>
+
+#include <common/StlTrace.h>
+
+TEST(StlTrace, Comments)
+{
+    EXPECT_TRUE(isStlComment(""));
+    EXPECT_TRUE(isStlComment("\r"));
+    EXPECT_TRUE(isStlComment("# 0: read 0x0"));
+    EXPECT_FALSE(isStlComment("0: read 0x0"));
+}
+
+TEST(StlTrace, ParsesRecords)
+{
+    auto read = parseStlRecord("12: read 0x1f40");
+    ASSERT_TRUE(read.has_value());
+    EXPECT_EQ(read->time, 12);
+    EXPECT_FALSE(read->length.has_value());
+    EXPECT_TRUE(read->isRead);
+    EXPECT_EQ(read->address, 0x1f40);
+    EXPECT_EQ(read->colon, 2);
+
+    auto write = parseStlRecord("7:\t(128) write 400 0x0102030405060708");
+    ASSERT_TRUE(write.has_value());
+    EXPECT_EQ(write->time, 7);
+    EXPECT_EQ(write->length, 128);
+    EXPECT_FALSE(write->isRead);
+    EXPECT_EQ(write->address, 0x400);
+}
+
+TEST(StlTrace, RejectsMalformedRecords)
+{
+    EXPECT_FALSE(parseStlRecord("read 0x0").has_value());
+    EXPECT_FALSE(parseStlRecord("12 read 0x0").has_value());
+    EXPECT_FALSE(parseStlRecord("12: fetch 0x0").has_value());
+    EXPECT_FALSE(parseStlRecord("12: (64 read 0x0").has_value());
+    EXPECT_FALSE(parseStlRecord("12: () read 0x0").has_value());
+    EXPECT_FALSE(parseStlRecord("12: read").has_value());
+}